@@ -39,6 +39,57 @@ MidiOutput::MidiOutput()
 {
 }
 
+#if ! JUCE_LINUX
+// splits the data into messages for sendMessageNow(), on platforms without a native version
+void MidiOutput::sendMessagesNow (const uint8* data, int numBytes)
+{
+    int status = 0;
+
+    while (numBytes > 0)
+    {
+        if (*data == 0xf0)
+        {
+            const uint8* end = static_cast<const uint8*> (memchr (data, 0xf7, (size_t) numBytes));
+            const int size = (end != nullptr) ? (int) (end + 1 - data) : numBytes;
+            sendMessageNow (MidiMessage (data, size));
+            data += size;
+            numBytes -= size;
+            status = 0;
+            continue;
+        }
+
+        if (*data >= 0xf8)
+        {
+            sendMessageNow (MidiMessage (*data));
+            ++data;
+            --numBytes;
+            continue;
+        }
+
+        if ((*data & 0x80) != 0)
+        {
+            status = *data++;
+            --numBytes;
+        }
+
+        const int dataBytes = MidiMessage::getMessageLengthFromFirstByte ((uint8) status) - 1;
+
+        if (status == 0 || dataBytes > numBytes)
+            break;
+
+        if (dataBytes == 2)
+            sendMessageNow (MidiMessage (status, data[0], data[1]));
+        else if (dataBytes == 1)
+            sendMessageNow (MidiMessage (status, data[0]));
+        else
+            sendMessageNow (MidiMessage (status));
+
+        data += dataBytes;
+        numBytes -= dataBytes;
+    }
+}
+#endif
+
 void MidiOutput::sendBlockOfMessages (const MidiBuffer& buffer,
                                       const double millisecondCounterToStartAt,
                                       double samplesPerSecondForBuffer)
@@ -90,6 +90,15 @@ public:
     */
     virtual void sendMessageNow (const MidiMessage& message);
 
+    /** Makes this device output a run of raw midi messages in one go.
+
+        The data can hold any number of complete messages, and may use running status.
+        Where the platform allows it, the messages are all queued and then flushed to
+        the device once, instead of once per message as sendMessageNow() does, and
+        nothing is allocated for short messages.
+    */
+    virtual void sendMessagesNow (const uint8* midiData, int numBytes);
+
     //==============================================================================
     /** This lets you supply a block of messages that will be sent out at some point
         in the future.
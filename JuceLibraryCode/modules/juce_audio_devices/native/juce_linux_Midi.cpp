@@ -456,6 +456,47 @@ public:
         snd_midi_event_reset_encode (midiParser);
     }
 
+    void sendMessagesNow (const uint8* data, long numBytes)
+    {
+        if (numBytes > maxEventSize)
+        {
+            maxEventSize = (int) numBytes;
+            snd_midi_event_free (midiParser);
+            snd_midi_event_new (maxEventSize, &midiParser);
+        }
+
+        snd_seq_t* seqHandle = port.client->get();
+        snd_seq_event_t event;
+
+        // the encoder keeps the running status from one message to the next
+        snd_midi_event_reset_encode (midiParser);
+
+        while (numBytes > 0)
+        {
+            snd_seq_ev_clear (&event);
+
+            const long numSent = snd_midi_event_encode (midiParser, data, numBytes, &event);
+            if (numSent <= 0)
+                break;
+
+            numBytes -= numSent;
+            data += numSent;
+
+            if (event.type == SND_SEQ_EVENT_NONE)
+                continue;
+
+            snd_seq_ev_set_source (&event, 0);
+            snd_seq_ev_set_subs (&event);
+            snd_seq_ev_set_direct (&event);
+
+            snd_seq_event_output (seqHandle, &event);
+        }
+
+        // one drain for the lot
+        snd_seq_drain_output (seqHandle);
+        snd_midi_event_reset_encode (midiParser);
+    }
+
 private:
     MidiOutput* const midiOutput;
     AlsaPort port;
@@ -520,6 +561,11 @@ void MidiOutput::sendMessageNow (const MidiMessage& message)
     static_cast <MidiOutputDevice*> (internal)->sendMessageNow (message);
 }
 
+void MidiOutput::sendMessagesNow (const uint8* midiData, int numBytes)
+{
+    static_cast <MidiOutputDevice*> (internal)->sendMessagesNow (midiData, numBytes);
+}
+
 //==============================================================================
 MidiInput::MidiInput (const String& nm)
     : name (nm), internal (nullptr)
@@ -597,6 +643,7 @@ MidiOutput* MidiOutput::openDevice (int)                            { return nul
 MidiOutput* MidiOutput::createNewDevice (const String&)             { return nullptr; }
 MidiOutput::~MidiOutput()   {}
 void MidiOutput::sendMessageNow (const MidiMessage&)    {}
+void MidiOutput::sendMessagesNow (const uint8*, int)    {}
 
 MidiInput::MidiInput (const String& nm) : name (nm), internal (nullptr)  {}
 MidiInput::~MidiInput() {}
@@ -0,0 +1,222 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "BackupArchive.h"
+
+#define BACKUP_FORMAT "micronau backup"
+#define BACKUP_VERSION 1
+
+// the syx is mostly the same few factory programs, worth the time to squeeze
+#define COMPRESSION_LEVEL 9
+
+static uint64 keyOf(uint64 soundHash, const String &name)
+{
+    return soundHash ^ ((uint64) name.hashCode64() * 0x9e3779b97f4a7c15ULL);
+}
+
+BackupArchive::BackupArchive() :
+    schema(IonSysexSchema::get()),
+    slotProgram(NUM_SLOTS, -1)
+{
+}
+
+BackupArchive::~BackupArchive()
+{
+}
+
+void BackupArchive::clear()
+{
+    slotProgram.assign(NUM_SLOTS, -1);
+    programs.clear();
+    keys.clear();
+    names.clearQuick();
+    byKey.clear();
+}
+
+int BackupArchive::addProgram(const unsigned char *program, uint64 key, const String &name)
+{
+    if (byKey.contains((int64) key)) {
+        return byKey[(int64) key];
+    }
+    int idx = (int) keys.size();
+    programs.insert(programs.end(), program, program + SYSEX_PROGRAM_SIZE);
+    keys.push_back(key);
+    names.add(name);
+    byKey.set((int64) key, idx);
+    return idx;
+}
+
+bool BackupArchive::setSlot(int slot, const unsigned char *program, int size)
+{
+    vector<int16> values(schema.numParams());
+    char name[15];
+
+    if ((slot < 0) || (slot >= NUM_SLOTS) || (schema.decodeProgram(program, size, &values[0], name) != PROGRAM_OK)) {
+        return false;
+    }
+    String n = programNameToString(name, sizeof(name));
+    slotProgram[slot] = addProgram(program, keyOf(schema.canonicalHash(&values[0]), n), n);
+    return true;
+}
+
+void BackupArchive::clearSlot(int slot)
+{
+    slotProgram[slot] = -1;
+}
+
+const unsigned char *BackupArchive::getSlot(int slot) const
+{
+    return hasSlot(slot) ? &programs[(size_t) slotProgram[slot] * SYSEX_PROGRAM_SIZE] : nullptr;
+}
+
+String BackupArchive::getName(int slot) const
+{
+    return hasSlot(slot) ? names[slotProgram[slot]] : String::empty;
+}
+
+uint64 BackupArchive::getKey(int slot) const
+{
+    return hasSlot(slot) ? keys[slotProgram[slot]] : 0;
+}
+
+int BackupArchive::numSlots() const
+{
+    int n = 0;
+    for (int i = 0; i < NUM_SLOTS; i++) {
+        n += hasSlot(i) ? 1 : 0;
+    }
+    return n;
+}
+
+int BackupArchive::numPrograms() const
+{
+    vector<bool> used(keys.size(), false);
+    int n = 0;
+    for (int i = 0; i < NUM_SLOTS; i++) {
+        if (hasSlot(i) && !used[slotProgram[i]]) {
+            used[slotProgram[i]] = true;
+            n++;
+        }
+    }
+    return n;
+}
+
+void BackupArchive::differences(const BackupArchive &current, Array<int> &slots) const
+{
+    slots.clearQuick();
+    for (int i = 0; i < NUM_SLOTS; i++) {
+        if (hasSlot(i) && (!current.hasSlot(i) || (current.getKey(i) != getKey(i)))) {
+            slots.add(i);
+        }
+    }
+}
+
+bool BackupArchive::write(const File &file)
+{
+    // only the programs still in a slot, in slot order
+    MemoryBlock syx;
+    vector<int> index(keys.size(), -1);
+    var slots;
+    int written = 0;
+    for (int i = 0; i < NUM_SLOTS; i++) {
+        if (!hasSlot(i)) {
+            continue;
+        }
+        int p = slotProgram[i];
+        if (index[p] < 0) {
+            index[p] = written++;
+            syx.append(&programs[(size_t) p * SYSEX_PROGRAM_SIZE], SYSEX_PROGRAM_SIZE);
+        }
+        DynamicObject *slot = new DynamicObject();
+        slot->setProperty("bank", i / PROGRAMS_PER_BANK + 1);
+        slot->setProperty("program", i % PROGRAMS_PER_BANK + 1);
+        slot->setProperty("name", names[p]);
+        slot->setProperty("key", String::toHexString((int64) keys[p]));
+        slot->setProperty("index", index[p]);
+        slots.append(var(slot));
+    }
+    DynamicObject *manifest = new DynamicObject();
+    var m(manifest);
+    manifest->setProperty("format", BACKUP_FORMAT);
+    manifest->setProperty("version", BACKUP_VERSION);
+    manifest->setProperty("created", Time::getCurrentTime().formatted("%Y-%m-%d %H:%M:%S"));
+    manifest->setProperty("programs", written);
+    manifest->setProperty("slots", slots);
+
+    // the zip builder only takes files
+    TemporaryFile manifestFile(".json"), syxFile(".syx");
+    if (!manifestFile.getFile().replaceWithText(JSON::toString(m)) || !syxFile.getFile().replaceWithData(syx.getData(), syx.getSize())) {
+        error = "can't write temporary files";
+        return false;
+    }
+    ZipFile::Builder zip;
+    zip.addFile(manifestFile.getFile(), COMPRESSION_LEVEL, "manifest.json");
+    zip.addFile(syxFile.getFile(), COMPRESSION_LEVEL, "programs.syx");
+
+    // written next to the file and moved over it, so a failed backup leaves the last one
+    TemporaryFile temp(file);
+    {
+        FileOutputStream out(temp.getFile());
+        if (out.failedToOpen() || !zip.writeToStream(out, nullptr)) {
+            error = "can't write " + file.getFullPathName();
+            return false;
+        }
+    }
+    if (!temp.overwriteTargetFileWithTemporary()) {
+        error = "can't write " + file.getFullPathName();
+        return false;
+    }
+    return true;
+}
+
+bool BackupArchive::read(const File &file)
+{
+    clear();
+    ZipFile zip(file);
+    const ZipFile::ZipEntry *manifestEntry = zip.getEntry("manifest.json");
+    const ZipFile::ZipEntry *syxEntry = zip.getEntry("programs.syx");
+    if ((manifestEntry == nullptr) || (syxEntry == nullptr)) {
+        error = "not a backup";
+        return false;
+    }
+    ScopedPointer<InputStream> manifestIn(zip.createStreamForEntry(*manifestEntry));
+    ScopedPointer<InputStream> syxIn(zip.createStreamForEntry(*syxEntry));
+    MemoryBlock syx;
+    if ((manifestIn == nullptr) || (syxIn == nullptr) || (syxIn->readIntoMemoryBlock(syx) != (int) syxEntry->uncompressedSize)) {
+        error = "can't read " + file.getFullPathName();
+        return false;
+    }
+    var m = JSON::parse(manifestIn->readEntireStreamAsString());
+    if ((m["format"].toString() != BACKUP_FORMAT) || ((int) m["version"] != BACKUP_VERSION)) {
+        error = "unsupported backup version";
+        return false;
+    }
+
+    IonSysexBank bank;
+    bank.parse(syx.getData(), syx.getSize(), 1);
+    const Array<var> *slots = m["slots"].getArray();
+    for (int i = 0; (slots != nullptr) && (i < slots->size()); i++) {
+        const var &s = slots->getReference(i);
+        int slot = slotOf((int) s["bank"] - 1, (int) s["program"] - 1);
+        int index = s["index"];
+        if ((slot < 0) || (slot >= NUM_SLOTS) || (index < 0) || (index >= bank.numMessages()) ||
+            (bank.getMessage(index).status != PROGRAM_OK)) {
+            clear();
+            error = "broken backup";
+            return false;
+        }
+        setSlot(slot, (const unsigned char *) syx.getData() + bank.getMessage(index).offset, SYSEX_PROGRAM_SIZE);
+        if (String::toHexString((int64) getKey(slot)) != s["key"].toString()) {
+            clear();
+            error = "backup doesn't match its manifest";
+            return false;
+        }
+    }
+    return true;
+}
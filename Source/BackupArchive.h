@@ -0,0 +1,68 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _BACKUPARCHIVE_H_
+#define _BACKUPARCHIVE_H_
+
+#include "IonSysexBank.h"
+
+// the programs of every slot of a micron, 8 banks of 128. on disk it's a zip holding
+//   manifest.json   what's in which slot: bank, program, name, key, index into programs.syx
+//   programs.syx    every distinct program once, as the dump it was read from
+// so a rack of units with the same factory banks backs up to little more than the
+// programs that were changed, and programs.syx opens in any librarian.
+class BackupArchive {
+   public:
+      enum {
+         NUM_BANKS = 8,
+         PROGRAMS_PER_BANK = 128,
+         NUM_SLOTS = NUM_BANKS * PROGRAMS_PER_BANK
+      };
+
+      BackupArchive();
+      ~BackupArchive();
+
+      // slots are bank * PROGRAMS_PER_BANK + program, both counted from 0
+      static int slotOf(int bank, int program) { return bank * PROGRAMS_PER_BANK + program; }
+
+      // false if it isn't a good program dump
+      bool setSlot(int slot, const unsigned char *program, int size);
+      void clearSlot(int slot);
+      void clear();
+
+      bool hasSlot(int slot) const { return slotProgram[slot] >= 0; }
+      const unsigned char *getSlot(int slot) const;    // SYSEX_PROGRAM_SIZE, nullptr if empty
+      String getName(int slot) const;
+      // the sound and the name of the slot's program, what a restore compares
+      uint64 getKey(int slot) const;
+      int numSlots() const;       // that hold a program
+      int numPrograms() const;    // distinct ones among them
+
+      // the slots this has a program for that current doesn't have the same one in
+      void differences(const BackupArchive &current, Array<int> &slots) const;
+
+      bool write(const File &file);
+      bool read(const File &file);     // see getError()
+      const String &getError() const { return error; }
+
+   private:
+      int addProgram(const unsigned char *program, uint64 key, const String &name);
+
+      const IonSysexSchema &schema;
+      vector<int> slotProgram;           // per slot, -1 if empty
+      vector<unsigned char> programs;    // SYSEX_PROGRAM_SIZE each
+      vector<uint64> keys;
+      Array<String> names;
+      HashMap<int64, int> byKey;
+      String error;
+
+      JUCE_DECLARE_NON_COPYABLE (BackupArchive)
+};
+
+#endif
@@ -0,0 +1,159 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "DeviceShadow.h"
+
+DeviceShadow::DeviceShadow() :
+    values(NUM_WIRE_NRPNS, (int) UNKNOWN)
+{
+    bank = 0;
+    program = 0;
+    diffRoom = 0;
+}
+
+void DeviceShadow::forget()
+{
+    std::fill(values.begin(), values.end(), (int) UNKNOWN);
+    bank = 0;
+    program = 0;
+}
+
+void DeviceShadow::set(int nrpn, int value)
+{
+    if ((nrpn >= 0) && (nrpn < NUM_WIRE_NRPNS)) {
+        values[nrpn] = value;
+    }
+}
+
+bool DeviceShadow::has(int nrpn, int value) const
+{
+    return (nrpn >= 0) && (nrpn < NUM_WIRE_NRPNS) && (values[nrpn] == value);
+}
+
+// the wire nrpn of a parameter the micron has, NO_NRPN for the plugin's own controls
+// below 512, which would land on some other parameter of the micron
+static int deviceNrpn(IonSysexParams &params, int idx)
+{
+    IonSysexParam *param = params.getParam(idx);
+    return (param->hasNrpn() && (param->getNrpn() >= 512)) ? params.wireNrpn(idx) : NO_NRPN;
+}
+
+void DeviceShadow::setProgram(IonSysexParams &params)
+{
+    std::fill(values.begin(), values.end(), (int) UNKNOWN);
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        int nrpn = deviceNrpn(params, i);
+        if (nrpn != NO_NRPN) {
+            set(nrpn, params.getParam(i)->getNrpnValue());
+        }
+    }
+}
+
+void DeviceShadow::setBankProgram(int b, int p)
+{
+    if (p > 0) {
+        std::fill(values.begin(), values.end(), (int) UNKNOWN);
+        program = p;
+    }
+    if (b > 0) {
+        bank = b;
+    }
+}
+
+void DeviceShadow::forgetFx(IonSysexParams &params, IonSysexParam *selector)
+{
+    int first = (selector->getNrpn() == FX1_SELECTOR) ? FX1_FIRST_NRPN : FX2_FIRST_NRPN;
+    int last = (selector->getNrpn() == FX1_SELECTOR) ? FX1_LAST_NRPN : FX2_LAST_NRPN;
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        int nrpn = params.getParam(i)->getNrpn();
+        int wire = params.wireNrpn(i);
+        if ((nrpn >= first) && (nrpn < last) && (wire != NO_NRPN)) {
+            values[wire] = UNKNOWN;
+        }
+    }
+}
+
+int DeviceShadow::numKnown(IonSysexParams &params) const
+{
+    int n = 0;
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        int nrpn = deviceNrpn(params, i);
+        if ((nrpn != NO_NRPN) && (values[nrpn] != UNKNOWN)) {
+            n++;
+        }
+    }
+    return n;
+}
+
+// one parameter, if the device doesn't have it already
+int DeviceShadow::encodeParam(int channel, IonSysexParams &params, int idx, NrpnStream &stream, unsigned char *buf)
+{
+    IonSysexParam *param = params.getParam(idx);
+    int nrpn = deviceNrpn(params, idx);
+    if ((nrpn == NO_NRPN) || has(nrpn, param->getNrpnValue())) {
+        return 0;
+    }
+    set(nrpn, param->getNrpnValue());
+    return stream.encodeNrpn(channel, nrpn, param->getNrpnValue(), buf);
+}
+
+int DeviceShadow::encodeDiff(int channel, IonSysexParams &params, NrpnStream &stream, unsigned char *buf, int size)
+{
+    int n = 0;
+    int b = params.getParamByNrpn(100)->getValue();
+    int p = params.getParamByNrpn(101)->getValue();
+
+    if (size < BANK_PROGRAM_MSG_SIZE) {
+        return 0;
+    }
+    if (((b > 0) && (b != bank)) || ((p > 0) && (p != program))) {
+        n += stream.encodeBankProgram(channel, b, p, buf);
+        setBankProgram(b, p);
+    }
+
+    // the selectors decide what the fx parameters' wire nrpns mean, so they go first
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        IonSysexParam *param = params.getParam(i);
+        if (!param->isFxSelector() || (n + NRPN_MSG_SIZE > size)) {
+            continue;
+        }
+        int sent = encodeParam(channel, params, i, stream, buf + n);
+        if (sent > 0) {
+            forgetFx(params, param);
+            n += sent;
+        }
+    }
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        if (params.getParam(i)->isFxSelector()) {
+            continue;
+        }
+        if (n + NRPN_MSG_SIZE > size) {
+            break;
+        }
+        n += encodeParam(channel, params, i, stream, buf + n);
+    }
+    return n;
+}
+
+int DeviceShadow::encodeDiff(int channel, IonSysexParams &params, NrpnStream &stream)
+{
+    int size = BANK_PROGRAM_MSG_SIZE + params.numParams() * NRPN_MSG_SIZE;
+    if (size > diffRoom) {
+        diff.malloc(size);
+        diffRoom = size;
+    }
+    return encodeDiff(channel, params, stream, diff, diffRoom);
+}
+
+bool DeviceShadow::prefersSysex(int diffSize, int sysexLoadMillis)
+{
+    int64 nrpnTime = (int64) diffSize * MIDI_BYTE_MICROS;
+    int64 sysexTime = (int64) SYSEX_PROGRAM_SIZE * MIDI_BYTE_MICROS + (int64) sysexLoadMillis * 1000;
+    return sysexTime < nrpnTime;
+}
@@ -0,0 +1,71 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _DEVICESHADOW_H_
+#define _DEVICESHADOW_H_
+
+#include "NrpnEncoder.h"
+
+// a byte takes 320us on a 31250 baud din link, start and stop bits included
+#define MIDI_BYTE_MICROS 320
+
+// how long the micron is busy taking in a program dump, on top of its transfer time
+#define SYSEX_LOAD_MILLIS 50
+
+// what the micron holds as far as we know, by wire nrpn: the values we last sent it
+// and were sure to arrive. a sync then only has to send what differs. anything that
+// may have reached the device some other way has to forget() it. the plugin's own
+// controls (nrpns below 512) aren't the micron's and are never sent by it.
+class DeviceShadow {
+   public:
+      DeviceShadow();
+
+      void forget();
+      void set(int nrpn, int value);    // a wire nrpn was sent
+      bool has(int nrpn, int value) const;
+
+      // the device now holds all of params, e.g. after a program dump was sent to it
+      void setProgram(IonSysexParams &params);
+
+      // a bank/program change loads that program, so nothing else is known after it.
+      // 1 based like the plugin's bank and program parameters, 0 is none.
+      void setBankProgram(int bank, int program);
+
+      // the parameters of the fx a selector picks share their wire nrpns with every
+      // other fx type's, so they aren't known any more once the selector changed
+      void forgetFx(IonSysexParams &params, IonSysexParam *selector);
+
+      // how many of params' wire values are known to be on the device
+      int numKnown(IonSysexParams &params) const;
+
+      // the messages that make the device hold params and marks them sent: bank/program
+      // change if it's another one, then the fx selectors that changed, then every other
+      // parameter that differs. stops early if size runs out.
+      int encodeDiff(int channel, IonSysexParams &params, NrpnStream &stream, unsigned char *buf, int size);
+
+      // the same into a buffer kept for it, which always has room. see getDiff(). if a
+      // program dump is sent instead, setProgram() puts that in place of the diff.
+      int encodeDiff(int channel, IonSysexParams &params, NrpnStream &stream);
+      const unsigned char *getDiff() const { return diff; }
+
+      // whether a program dump gets the device to hold a program sooner than diffSize
+      // bytes of nrpns, by wire time and the time the device takes to load a dump
+      static bool prefersSysex(int diffSize, int sysexLoadMillis = SYSEX_LOAD_MILLIS);
+
+   private:
+      int encodeParam(int channel, IonSysexParams &params, int idx, NrpnStream &stream, unsigned char *buf);
+
+      enum { NUM_WIRE_NRPNS = 2048, UNKNOWN = -0x8000 - 1 };
+      vector<int> values;     // per wire nrpn, UNKNOWN if not known
+      int bank, program;      // 0 if not known
+      HeapBlock<unsigned char> diff;
+      int diffRoom;
+};
+
+#endif
@@ -0,0 +1,167 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "HardwareBackup.h"
+
+// a request that isn't answered is sent again this many times
+#define RETRIES 2
+
+HardwareBackup::HardwareBackup(Device &d, int t, int w) :
+    Thread("hardware backup"), device(d), answerTimeout(t), writeDelay(w), restoring(false), answerSize(0)
+{
+}
+
+HardwareBackup::~HardwareBackup()
+{
+    stopThread(answerTimeout + 1000);
+}
+
+bool HardwareBackup::startBackup(const File &archive)
+{
+    if (isThreadRunning()) {
+        return false;
+    }
+    archiveFile = archive;
+    restoring = false;
+    startThread();
+    return true;
+}
+
+bool HardwareBackup::startRestore(const File &archive)
+{
+    if (isThreadRunning()) {
+        return false;
+    }
+    archiveFile = archive;
+    restoring = true;
+    startThread();
+    return true;
+}
+
+void HardwareBackup::run()
+{
+    BackupArchive current, wanted;
+    setError(String::empty);
+
+    if (!restoring) {
+        if (readDevice(current) && !current.write(archiveFile)) {
+            setError(current.getError());
+        }
+    } else if (!wanted.read(archiveFile)) {
+        setError(wanted.getError());
+    } else if (readDevice(current)) {
+        writeDevice(wanted, current);
+    }
+    phase = IDLE;
+}
+
+void HardwareBackup::programReceived(const void *data, int size)
+{
+    if ((expecting.get() == 0) || (size != SYSEX_PROGRAM_SIZE)) {
+        return;
+    }
+    {
+        const ScopedLock sl(answerLock);
+        memcpy(answer, data, SYSEX_PROGRAM_SIZE);
+        answerSize = size;
+        received += 1;
+    }
+    answered.signal();
+}
+
+// until more than count answers have come in, false if none comes for answerTimeout
+bool HardwareBackup::waitForAnswer(int count)
+{
+    while (received.get() <= count) {
+        if (!answered.wait(answerTimeout)) {
+            return received.get() > count;
+        }
+    }
+    return true;
+}
+
+bool HardwareBackup::readDevice(BackupArchive &into)
+{
+    into.clear();
+    phase = READING;
+    done = 0;
+    written = 0;
+    total = BackupArchive::NUM_SLOTS;
+    expecting = 1;
+
+    for (int slot = 0; slot < BackupArchive::NUM_SLOTS; slot++) {
+        int bank = slot / BackupArchive::PROGRAMS_PER_BANK, program = slot % BackupArchive::PROGRAMS_PER_BANK;
+        bool got = false;
+        int first = received.get(), seen = first, requests = 0;
+        for (int attempt = 0; !got && (attempt <= RETRIES); attempt++) {
+            if (threadShouldExit()) {
+                expecting = 0;
+                setError("cancelled");
+                return false;
+            }
+            device.requestProgram(bank, program);
+            requests++;
+            if (waitForAnswer(seen)) {
+                const ScopedLock sl(answerLock);
+                seen = received.get();
+                got = into.setSlot(slot, answer, answerSize);
+            }
+        }
+        // the micron answers in order, a request that timed out can still be answered after
+        // the one sent again. that answer is for this slot too, and mustn't be taken for the
+        // next one: every request gets another answerTimeout to be answered before moving on.
+        if (got) {
+            waitForAnswer(first + requests - 1);
+        }
+        if (!got) {
+            expecting = 0;
+            setError("no answer for bank " + String(bank + 1) + " program " + String(program + 1));
+            return false;
+        }
+        done = slot + 1;
+    }
+    expecting = 0;
+    return true;
+}
+
+bool HardwareBackup::writeDevice(const BackupArchive &wanted, const BackupArchive &current)
+{
+    Array<int> slots;
+    wanted.differences(current, slots);
+    phase = WRITING;
+    done = 0;
+    written = 0;
+    total = slots.size();
+
+    for (int i = 0; i < slots.size(); i++) {
+        if (threadShouldExit()) {
+            setError("cancelled");
+            return false;
+        }
+        int slot = slots[i];
+        device.writeProgram(slot / BackupArchive::PROGRAMS_PER_BANK, slot % BackupArchive::PROGRAMS_PER_BANK, wanted.getSlot(slot));
+        // the micron needs a moment to store it before it takes the next one
+        wait(writeDelay);
+        done = i + 1;
+        written = i + 1;
+    }
+    return true;
+}
+
+void HardwareBackup::setError(const String &e)
+{
+    const ScopedLock sl(errorLock);
+    error = e;
+}
+
+String HardwareBackup::getError() const
+{
+    const ScopedLock sl(errorLock);
+    return error;
+}
@@ -0,0 +1,87 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _HARDWAREBACKUP_H_
+#define _HARDWAREBACKUP_H_
+
+#include "BackupArchive.h"
+
+// backs up every slot of a micron into a BackupArchive and restores one, on its own
+// thread. slots are read one request at a time, the micron answers each with a program
+// dump that has to be handed to programReceived(). a request that isn't answered in
+// time is sent again, and its late answer waited for before the next slot is asked for.
+// a restore reads the unit first and only writes the slots whose program (sound or name)
+// differs from the archive's.
+class HardwareBackup : public Thread {
+   public:
+      // the midi side, called on the backup thread
+      class Device {
+         public:
+            virtual ~Device() {}
+            virtual void requestProgram(int bank, int program) = 0;      // from 0
+            virtual void writeProgram(int bank, int program, const unsigned char *dump) = 0;
+      };
+
+      HardwareBackup(Device &device, int answerTimeout = 2000, int writeDelay = 150);
+      ~HardwareBackup();    // stops the thread
+
+      // run on the thread, false if one is running already
+      bool startBackup(const File &archive);
+      bool startRestore(const File &archive);
+
+      // the same on the calling thread. false on a timeout or when the thread is told to
+      // exit, what was read or written so far stands. see getError().
+      bool readDevice(BackupArchive &into);
+      bool writeDevice(const BackupArchive &wanted, const BackupArchive &current);
+
+      // a program dump from the midi input, any thread. ignored unless one is expected.
+      void programReceived(const void *data, int size);
+      bool isExpectingPrograms() const { return expecting.get() != 0; }
+
+      enum Phase {
+         IDLE,
+         READING,
+         WRITING
+      };
+      bool isBusy() const { return isThreadRunning(); }
+      Phase getPhase() const { return (Phase) phase.get(); }    // of the last read or write
+      int getProgress() const { return done.get(); }    // slots read or written in this phase
+      int getTotal() const { return total.get(); }
+      int getWritten() const { return written.get(); }
+      String getError() const;
+
+      void run();
+
+   private:
+      bool waitForAnswer(int count);
+      void setError(const String &e);
+
+      Device &device;
+      const int answerTimeout;
+      const int writeDelay;
+      File archiveFile;
+      bool restoring;
+
+      Atomic<int> expecting;
+      Atomic<int> phase;
+      Atomic<int> done;
+      Atomic<int> total;
+      Atomic<int> written;
+      Atomic<int> received;      // answers so far
+      WaitableEvent answered;
+      CriticalSection answerLock;
+      unsigned char answer[SYSEX_PROGRAM_SIZE];
+      int answerSize;
+      String error;
+      CriticalSection errorLock;
+
+      JUCE_DECLARE_NON_COPYABLE (HardwareBackup)
+};
+
+#endif
@@ -20,9 +20,7 @@
 */
 
 #include "IonSysex.h"
-#include <CoreFoundation/CoreFoundation.h>
 #include <math.h>
-#include "../JuceLibraryCode/JuceHeader.h"
 #include "tinyxml.h"
 
 
@@ -31,11 +29,12 @@
 #include <string.h>
 
 #include <map>
+#include <algorithm>
 #include "mapping.h"
+// the cmake build regenerates the tables in its build directory
+#include "params_table.h"
 
-#define SYSEX_PROGRAM_SIZE 434
-
-static UInt32 checksum(unsigned char *buff, UInt32 len);
+uint32 toBigEndian(const unsigned char *b);
 
 void logDebug(const char *s)
 {
@@ -114,56 +113,75 @@ static bool decodeFromMidi(vector<unsigned char> &encoded, vector<unsigned char>
     return true;
 }
 
+// word at a time versions of the above. each group of 7 raw bytes is handled as one
+// 64 bit word: the high bits are gathered into (or spread out of) the leading midi byte
+// with a single multiply, so there are no per byte loops or temporary buffers.
+static inline uint64 loadGroup(const unsigned char *p, int n)
+{
+    uint64 w = 0;
+    memcpy(&w, p, n);
+    return ByteOrder::swapIfBigEndian(w);
+}
 
-static vector<string> init_string_vector(const char *strorig)
-{
-   char *ptr1, *ptr2, *ptr3;
-   char *buf = NULL;
-   int curBufLen = 0;
-   vector<string>ret;
-   bool done = false;
-   char *str = strdup(strorig);
-   ptr1 = ptr2 = str;
-   while(!done){
-      // get rid of trailing space
-      if(*ptr2 == ' ') while(*ptr2 == ' ') ptr2++;
-      // anchor the first pointer
-      ptr1 = ptr2;
-      // find the next comma or the end of the string
-      while(*ptr2 != ',' && *ptr2 != '\0')
-         ptr2++;
-      if(*ptr2 == '\0')
-         done = true;
-      // take out trailing space
-      ptr3 = ptr2;
-      while(*(ptr3 - 1) == ' ')
-         ptr3--;
-      // check the length of the string
-      // and reallocate buffer if necessary
-      if((ptr3 - ptr1) > curBufLen){
-         curBufLen = (ptr3 - ptr1) + 1;
-         if(buf != NULL) delete buf;
-         buf = new char[curBufLen];
-      }
-      *ptr3 = '\0';
-      // put the string on the vector
-      ret.push_back(ptr1);
-      if(!done)
-         ptr2++;
-   }
-   if(buf != NULL) delete buf;
-   free(str);
-   return ret;
+static inline void storeGroup(unsigned char *p, uint64 w, int n)
+{
+    w = ByteOrder::swapIfBigEndian(w);
+    memcpy(p, &w, n);
 }
 
-static void hexdump(char *ptr, int n)
+void midiPack7(const unsigned char *raw, unsigned char *encoded, int groups)
 {
-   for (int i = 0; i < n; i++){
-      unsigned int a = ptr[i];
-      a = a & 0x000000FF;
-      printf("%02x ", a);
-   }
-   cout << endl;
+    for (int i = 0; i < groups; i++) {
+        uint64 w = loadGroup(raw, 7);
+        // bit 7 of byte j ends up in bit 6-j of the high bits byte
+        uint64 highbits = (((w >> 7) & 0x0001010101010101ULL) * 0x4020100804020100ULL) >> 56;
+        storeGroup(encoded, ((w & 0x007f7f7f7f7f7f7fULL) << 8) | highbits, 8);
+        raw += 7;
+        encoded += 8;
+    }
+}
+
+void midiUnpack7(const unsigned char *encoded, unsigned char *raw, int groups)
+{
+    // every group is fully loaded before anything is written, and raw never gets ahead
+    // of encoded, so this also works in place.
+    for (int i = 0; i < groups; i++) {
+        uint64 w = loadGroup(encoded, 8);
+        // bit 6-j of the high bits byte goes back to bit 7 of byte j
+        uint64 highbits = ((w & 0x7f) * 0x0080402010080402ULL) & 0x0080808080808080ULL;
+        storeGroup(raw, (w >> 8) | highbits, 7);
+        encoded += 8;
+        raw += 7;
+    }
+}
+
+String programNameToString(const char *name, int maxBytes)
+{
+    int len = (int) strnlen(name, maxBytes);
+    if (CharPointer_UTF8::isValidString(name, len)) {
+        return String::fromUTF8(name, len);
+    }
+    String s;
+    for (int i = 0; i < len; i++) {
+        s += String::charToString((juce_wchar) (unsigned char) name[i]);
+    }
+    return s;
+}
+
+ProgramStatus checkProgramHeader(const unsigned char *program, int size)
+{
+    if ((size < 2) || (program[0] != 0xf0) || (program[size - 1] != 0xf7)) {
+        return PROGRAM_BAD_SIZE;
+    }
+    // same check as readProgramContent, the opcode isn't looked at
+    static const unsigned char header[] = { 0x00, 0x00, 0x0e, 0x22 };
+    if ((size < 1 + (int) sizeof(header)) || (memcmp(&program[1], header, sizeof(header)) != 0)) {
+        return PROGRAM_NOT_PROGRAM;
+    }
+    if (size != SYSEX_PROGRAM_SIZE) {
+        return PROGRAM_BAD_SIZE;
+    }
+    return PROGRAM_OK;
 }
 
 void tomSecSec(char *buf, float v)
@@ -201,12 +219,12 @@ m_hasSpecialNrpnValue(false),
 m_nrpnValue(0)
 {}
 
-const char * ListItemParameter::getName()
+const char * ListItemParameter::getName() const
 {
     return m_name;
 }
 
-bool ListItemParameter::isDisabled()
+bool ListItemParameter::isDisabled() const
 {
     return !m_enabled;
 }
@@ -216,7 +234,7 @@ void ListItemParameter::setEnabled(bool enabled)
     m_enabled = enabled;
 }
 
-bool ListItemParameter::hasSpecialNrpnValue()
+bool ListItemParameter::hasSpecialNrpnValue() const
 {
     return m_hasSpecialNrpnValue;
 }
@@ -227,203 +245,226 @@ void ListItemParameter::setSpecialNrpnValue(int nrpn)
     m_hasSpecialNrpnValue = true;
 }
 
-int ListItemParameter::getNrpnValue()
+int ListItemParameter::getNrpnValue() const
 {
     return m_nrpnValue;
 }
 
 ///// IonSysexParam
 
-IonSysexParam::IonSysexParam(const char *name)
+IonSysexParam::IonSysexParam(IonSysexParams *owner, int index)
 {
-   m_name = name;
-   m_conv = NONE;
-   m_nrpn = -1;
-   m_offset = -1;
-   m_valueSet = false;
-   m_cntrlOffset = 0;
-   m_paramName = NULL;
-   m_defaultValue = 0;
-   m_textValue = String("");
+   m_desc = &owner->schema.getDesc(index);
+   m_owner = owner;
+   m_index = index;
+}
 
-   init_mapping();   
- }
+const char *IonSysexParam::getName()
+{
+   return m_desc->name;
+}
+
+int IonSysexParam::getDefaultValue()
+{
+   return m_desc->defaultValue;
+}
+
+int IonSysexParam::getMin()
+{
+   return m_desc->min - m_desc->cntrlOffset;
+}
+
+int IonSysexParam::getMax()
+{
+   return m_desc->max - m_desc->cntrlOffset;
+}
 
 String IonSysexParam::getTextValue()
 {
-    return m_textValue;
+    if (m_desc->conv == NAME) {
+        return m_owner->get_prog_name();
+    }
+    return String::empty;
 }
 
 bool IonSysexParam::setTextValue(const char *str)
 {
-	char buff[15];
-	strncpy(buff, str, 14);
-	buff[14] = 0;
-    m_textValue = String(buff);
+    if (m_desc->conv != NAME) {
+        return false;
+    }
+    m_owner->set_prog_name(String(str));
     return true;
 }
 
 String IonSysexParam::getParamName()
 {
-	return String(m_paramName);
+	return String(m_desc->paramName);
 }
 
-void IonSysexParam::setParamName(const char *str)
+// display text of val (value + cntrloffset) for parameters without a list
+void IonSysexParam::formatValue(Conversion conv, int val, char *buf)
 {
-    m_paramName = str;
-}
-
-String IonSysexParam::getConvertedValue(SInt32 val)
-{
-    char buf[128];
-	val = getValue() + m_cntrlOffset;
-	if (getList().size() != 0) {
-		return String(getList()[val].getName());
-	}
-	else {
-		switch(m_conv){
-			case BANK:
-				if (val == 0) {
+	switch(conv){
+		case BANK:
+			if (val == 0) {
                     sprintf(buf,"None");
                 } else {
                     sprintf(buf,"%d", (int)(val - 1));
                 }
+			break;
+		case PERCENT:
+			sprintf(buf,"%d%%",(int)val);
+			break;
+		case WET_DRY:
+			sprintf(buf, "%d%% dry, %d%% wet", (int)(50-val), (int)(50+val));
+			break;
+		case POST_BAL:
+			if (val == 0) {
+				strcpy(buf, "Center");
 				break;
-			case PERCENT:
-				sprintf(buf,"%d%%",(int)val);
-				break;
-			case WET_DRY:
-				sprintf(buf, "%d%% dry, %d%% wet", (int)(50-val), (int)(50+val));
-				break;
-			case POST_BAL:
-				if (val == 0) {
-					strcpy(buf, "Center");
-					break;
-				}
-				if (val < 0) {
-					sprintf(buf, "%d%% left", (int)-val);
-				} else {
-					sprintf(buf, "%d%% right", (int)val);
-				}
-				break;
-			case PRE_BAL:
-				if (val < 0) {
-					sprintf(buf, "%d%% f1, %d%% f2", (int)(-val+50), (int)(50+val));
-				} else {
-					sprintf(buf, "%d%% f1, %d%% f2", (int)(50-val), (int)(val+50));
-				}
-				break;
-			case TENTHS_OF_PERCENT:
-				sprintf(buf,"%.1f%%",((val)/10.0));
+			}
+			if (val < 0) {
+				sprintf(buf, "%d%% left", (int)-val);
+			} else {
+				sprintf(buf, "%d%% right", (int)val);
+			}
+			break;
+		case PRE_BAL:
+			if (val < 0) {
+				sprintf(buf, "%d%% f1, %d%% f2", (int)(-val+50), (int)(50+val));
+			} else {
+				sprintf(buf, "%d%% f1, %d%% f2", (int)(50-val), (int)(val+50));
+			}
+			break;
+		case TENTHS_OF_PERCENT:
+			sprintf(buf,"%.1f%%",((val)/10.0));
+			break;
+		case PITCH_FINE:
+			sprintf(buf,"%.1f",((val)/10.0));
+			break;
+		case BALANCE:
+			sprintf(buf,"%d",(int)(50 - val));
+			break;
+		case FX1_FX2_BALANCE:
+			
+			sprintf(buf,"%d%% fx1 %d%% fx2",(int)(50 - val),(int)(100-(50-val)));
+			break;
+		case FILTER_OFFSET_FREQ:
+			hzToString(buf, (float) (20 * pow((float) 1000, (float) val/1023)));
+			break;
+		case FILTER_OFFSET_OCT:
+			sprintf(buf,"%.2f Oct",val/100.0);
+			break;
+		case FILTER_FREQ:
+			if(val == 920) strcpy(buf,"10.000 KHz");
+			else{
+				float hz = 20 * pow((float) 1000, (float) val/1023);
+				hzToString(buf, hz);
+			}
+			break;
+		case ENV_TIME:
+			if (val == 256) {
+				strcpy(buf, "Hold");
+			} else {
+				tomSecSec(buf,  0.5 * pow((float) (30000/0.5), (float) val/255));
+			}
+			break;
+		case PORTA_TIME:
+			tomSecSec(buf,  10 * pow((float) 1000, (float) val/127));
+			break;
+		case LFO_FREQ:
+			hzToString(buf, (float) 0.01 * pow((float) (1000/.01), (float) val/1023));
+			break;
+		case FX_LFO_FREQ:
+			hzToString(buf, (float) 0.01 * pow((float) (4.8/.01), (float) val/127));
+			break;
+		case MS:
+			sprintf(buf,"%d ms",(int) val);
+			break;
+		case OCTAVE:
+			if ((val == 1) || (val == -1)) {
+				sprintf(buf,"%d octave",(int) val);
+			} else {
+				sprintf(buf,"%d octaves",(int) val);
+			}	
+			break;
+
+		case SEMITONE:
+			if ((val == 1) || (val == -1)) {
+				sprintf(buf,"%d semitone",(int) val);
+			} else {
+				sprintf(buf,"%d semitones",(int) val);
+			}	
+			break;
+		case RELEASE_TIME:
+			tomSecSec(buf, (float) 2 * pow((float) 30000/2, (float) val/255));
+			break;
+		case EXT_IN:
+			if (val == 0) {
+				strcpy(buf, "L to f1, R to f2");
 				break;
-			case PITCH_FINE:
-				sprintf(buf,"%.1f",((val)/10.0));
+			}
+			if (val == -100) {
+				strcpy(buf, "L and R to f1");
 				break;
-			case BALANCE:
-				sprintf(buf,"%d",(int)(50 - val));
+			}
+			if (val == 100) {
+				strcpy(buf, "L and R to f2");
 				break;
-			case FX1_FX2_BALANCE:
+			}
+			if (val < 0) {
+				sprintf(buf, "L and %d%% R to f1", (int)-val);
+			} else {
+				sprintf(buf, "R and %d%% L to f2", (int)val);
+			}
+			break;
 				
-				sprintf(buf,"%d%% fx1 %d%% fx2",(int)(50 - val),(int)(100-(50-val)));
-				break;
-			case FILTER_OFFSET_FREQ:
-				hzToString(buf, (float) (20 * pow((float) 1000, (float) val/1023)));
-				break;
-			case FILTER_OFFSET_OCT:
-				sprintf(buf,"%.2f Oct",val/100.0);
-				break;
-			case FILTER_FREQ:
-				if(val == 920) strcpy(buf,"10.000 KHz");
-				else{
-					float hz = 20 * pow((float) 1000, (float) val/1023);
-					hzToString(buf, hz);
-				}
-				break;
-			case ENV_TIME:
-				if (val == 256) {
-					strcpy(buf, "Hold");
-				} else {
-					tomSecSec(buf,  0.5 * pow((float) (30000/0.5), (float) val/255));
-				}
-				break;
-			case PORTA_TIME:
-				tomSecSec(buf,  10 * pow((float) 1000, (float) val/127));
-				break;
-			case LFO_FREQ:
-				hzToString(buf, (float) 0.01 * pow((float) (1000/.01), (float) val/1023));
-				break;
-			case FX_LFO_FREQ:
-				hzToString(buf, (float) 0.01 * pow((float) (4.8/.01), (float) val/127));
-				break;
-			case MS:
-				sprintf(buf,"%d ms",(int) val);
-				break;
-			case OCTAVE:
-				if ((val == 1) || (val == -1)) {
-					sprintf(buf,"%d octave",(int) val);
-				} else {
-					sprintf(buf,"%d octaves",(int) val);
-				}	
-				break;
+		default:
+			sprintf(buf,"%d", (int)val);
+			break;
+	}
+}
 
-			case SEMITONE:
-				if ((val == 1) || (val == -1)) {
-					sprintf(buf,"%d semitone",(int) val);
-				} else {
-					sprintf(buf,"%d semitones",(int) val);
-				}	
-				break;
-			case RELEASE_TIME:
-				tomSecSec(buf, (float) 2 * pow((float) 30000/2, (float) val/255));
-				break;
-			case EXT_IN:
-				if (val == 0) {
-					strcpy(buf, "L to f1, R to f2");
-					break;
-				}
-				if (val == -100) {
-					strcpy(buf, "L and R to f1");
-					break;
-				}
-				if (val == 100) {
-					strcpy(buf, "L and R to f2");
-					break;
-				}
-				if (val < 0) {
-					sprintf(buf, "L and %d%% R to f1", (int)-val);
-				} else {
-					sprintf(buf, "R and %d%% L to f2", (int)val);
-				}
-				break;
-					
-			default:
-				sprintf(buf,"%d", (int)val);
-				break;
-	   }
+String IonSysexParam::getConvertedValue(int32 val)
+{
+	const String *text = m_owner->schema.findValueText(m_index, val);
+	if (text) {
+		return *text;
+	}
+	if (getList().size() != 0) {
+		return String::empty;
 	}
+	char buf[128];
+	formatValue(m_desc->conv, val + m_desc->cntrlOffset, buf);
 	return String(buf);
 }
 
+const String &IonSysexParam::getValueText(int value)
+{
+	const String *text = m_owner->schema.findValueText(m_index, value);
+	return text ? *text : String::empty;
+}
+
+bool IonSysexParam::getValueFromText(const String &text, int &value)
+{
+	return m_owner->schema.findTextValue(m_index, text, value);
+}
+
 int IonSysexParam::getValue()
 {
-    if(m_valueSet)  {
-		return m_value;
-	}
-    m_value = m_min;
-    m_valueSet = true;
-    return m_value;
+    return m_owner->values[m_index];
 }
 
-int IonSysexParam::getBitWidth()
+static int bitWidth(const IonSysexParamDesc &d)
 {
-   int l_min = m_min;
-   if ((m_nrpn >= FX1_FIRST_NRPN) && (m_nrpn < FX1_LAST_NRPN)) {
+   int l_min = d.min;
+   if ((d.nrpn >= FX1_FIRST_NRPN) && (d.nrpn < FX1_LAST_NRPN)) {
 	 return 8;
    }
-   if ((m_nrpn >= FX2_FIRST_NRPN) && (m_nrpn < FX2_LAST_NRPN)) {
+   if ((d.nrpn >= FX2_FIRST_NRPN) && (d.nrpn < FX2_LAST_NRPN)) {
 	 return 16;
    }
-   switch(m_offset) {
+   switch(d.offset) {
    case 282:
 	 return 2;
    case 152:
@@ -431,18 +472,20 @@ int IonSysexParam::getBitWidth()
    case 278:
 	 return 1;
    }
-   if (m_offset == 282) {
-	  return 2;
-   }
-   if (m_offset == 2240) {
+   if (d.offset == 2240) {
       l_min = -100;
    }
-   int biggest = m_max + 1 > l_min ? m_max + 1 : - l_min;
+   int biggest = d.max + 1 > l_min ? d.max + 1 : - l_min;
    int bits = int(log((float)biggest)/log(2.0) + 0.9999);
    if(l_min < 0) bits++;
    return bits;
 }
 
+int IonSysexParam::getBitWidth()
+{
+   return bitWidth(*m_desc);
+}
+
 int getValueOfByte(char b){
    int res = 0;
    for(int i = 0; i < 8; i++){
@@ -452,38 +495,22 @@ int getValueOfByte(char b){
 }
 
 
-bool IonSysexParam::setNameFromContent(unsigned char *content)
-{
-   char name[15];
-   memset(name, 0, 15);
-   memcpy(name,&content[m_offset/8],15);
-   name[14] = 0;
-   m_textValue = String(name);
-   m_valueSet = true;
-   return true;
-}
-
 void IonSysexParam::setValue(int value)
 {
-    m_value = value;
-    m_valueSet = true;
+    m_owner->values[m_index] = (int16) value;
+    m_owner->paramChanged(m_index);
     return;
 }
 
-void IonSysexParam::setNrpn(int nrpn)
-{
-    m_nrpn = nrpn;
-}
-
 bool IonSysexParam::writeNameToBuffer(unsigned char *buffer)
 {
 	char str[16];
-	bzero(str, sizeof(str));
-	m_textValue.copyToUTF8(str, sizeof(str));
+	memset(str, 0, sizeof(str));
+	memcpy(str, m_owner->m_prog_name, 14);
 //	const char *str = CFStringGetCStringPtr(m_textValue, 0);
-	bzero(&buffer[m_offset/8], 15);
-	memcpy((char *) &buffer[m_offset/8], str, 14);
-	bzero(&buffer[296], 15);
+	memset(&buffer[m_desc->offset/8], 0, 15);
+	memcpy((char *) &buffer[m_desc->offset/8], str, 14);
+	memset(&buffer[296], 0, 15);
 	memcpy(&buffer[296], str, 14);
 	return true;
 }
@@ -500,293 +527,275 @@ static void setBit(unsigned char *buffer, int offset, short val)
 	buffer[offset/8] = b;
 }
 
-bool IonSysexParam::writeValueToBuffer(unsigned char *buffer)
+// fields that are spread over several bits of the program, or stored in some other odd way
+static int decodeSpecialField(int special, int result, const unsigned char *content)
 {
-	int i;
-    if(m_conv == NAME){
-        return true;
-    }
-	if (m_offset < 0) {
-		return true;
-	}
-	/*
-		if (id >= 844) {
-			// this will check whether the id is it currently selected fx and if so return true
-			if (!shouldWrite(id)) {
-				return true;
+	switch (special) {
+		case IonSysexField::FM_ALGORITHM:
+			// fm lin/exp lives in bit 295, algorithm in the field itself
+			return (result & 0x3) + getBit(295)*3;
+		case IonSysexField::OSC_SYNC: {
+			// 0: off, 1: hard 2->1, 2: hard 2+3->1, 3: soft 2->1, 4: soft 2+3->1
+			int sync_onoff = getBit(278);
+			int sync_type = getBit(280);
+			sync_type = (sync_type == 0) ? 1 : 0;
+			int sync_route = getBit(279);
+			if (sync_onoff == 1) {
+				return 0;
 			}
+			return sync_type*2 + sync_route + 1;
 		}
-	*/
-    int bits = getBitWidth();
-    int byte_offset = m_offset / 8;
-    unsigned char tmp;
-//    printf("writing %s. Bits: %d, Byte Offset: %d value %d\n", m_name, bits, byte_offset, m_value);
-
-    short s_value = (short) m_value;
-	s_value += getCntrlOffset();
-    if(s_value < m_min)
-        s_value = m_min;
-    if(s_value > m_max)
-        s_value = m_max;
-	
-	if (m_offset == 282) {
-		// fm algorithm lin/exp
-		setBit(buffer, 295, ((s_value >= 3) ? 1 : 0));
-		if (s_value >=3) {
-			s_value -= 3;
-		}
+		case IonSysexField::PORTAMENTO:
+			return (getBit(135) == 0) ? result+1 : 0;
+		case IonSysexField::UNISON:
+			return (getBit(121) == 0) ? result+1 : 0;
+		case IonSysexField::FX_MIX:
+			// fx wet dry all screwed up!
+			return result/2;
 	}
+	return result;
+}
 
-	if (m_offset == 122) {
-		// unison 
-		if (s_value > 0) {
-			// unison on
-			setBit(buffer, 121, 0);
-//			s_value -= 1;
-		} 	else {
-			// unison off
-			setBit(buffer, 121, 1);
-		}
+static int encodeSpecialField(int special, short s_value, unsigned char *buffer)
+{
+	switch (special) {
+		case IonSysexField::FM_ALGORITHM:
+			// fm algorithm lin/exp
+			setBit(buffer, 295, ((s_value >= 3) ? 1 : 0));
+			if (s_value >= 3) {
+				s_value -= 3;
+			}
+			break;
+		case IonSysexField::OSC_SYNC:
+			if (s_value > 0) {
+				s_value--;
+				int sync_type = (s_value >> 1) & 1;
+				sync_type = (sync_type == 0) ? 1 : 0;
+				int sync_route = s_value & 1;
+				setBit(buffer, 280, sync_type);
+				setBit(buffer, 279, sync_route);
+				s_value = 0;
+			} else {
+				s_value = 1;
+			}
+			break;
+		case IonSysexField::PORTAMENTO:
+			if (s_value > 0) {
+				// portamento on
+				setBit(buffer, 135, 0);
+				s_value -= 1;
+			} else {
+				setBit(buffer, 135, 1);
+			}
+			break;
+		case IonSysexField::UNISON:
+			if (s_value > 0) {
+				// unison on
+				setBit(buffer, 121, 0);
+				s_value--;
+			} else {
+				setBit(buffer, 121, 1);
+			}
+			break;
+		case IonSysexField::FX_MIX:
+			s_value = (s_value*2);
+			break;
 	}
-	
- 	if (m_offset == 152) {
-		// portamento 
-		if (s_value > 0) {
-			// portamento on
-			setBit(buffer, 135, 0);
-			s_value -= 1;
-		} 	else {
-			setBit(buffer, 135, 1);
-		}
+	return s_value;
+}
+
+// work out once per parameter how it is stored in the decoded program, so that
+// decoding and encoding a whole patch is a single pass over this table.
+bool IonSysexSchema::describeField(int idx, IonSysexField &f) const
+{
+	const IonSysexParamDesc &d = paramTable[idx];
+	int i;
+	if ((d.conv == IonSysexParam::NAME) || (d.conv == IonSysexParam::TEXT_LABEL) || (d.offset < 0)) {
+		return false;
 	}
 
-   // osc sync param
-    if (m_offset == 278) {
-		if (s_value > 0) {
-			s_value--;
-			int sync_type = (s_value >> 1) & 1;
-			sync_type = (sync_type == 0) ? 1 : 0;
-			int sync_route = s_value & 1;
-			setBit(buffer, 280, sync_type);
-			setBit(buffer, 279, sync_route);
-			s_value = 0;
+	int bits = bitWidth(d);
+	int l_min = d.min;
+	int l_max = d.max;
+
+	f.paramIndex = idx;
+	f.nrpn = d.nrpn;
+	f.byteOffset = d.offset / 8;
+	f.hiByteOffset = -1;
+	f.shift = 0;
+	f.mask = 0xff;
+	f.signBit = 0;
+	f.bias = 0;
+	f.cntrlOffset = d.cntrlOffset;
+	f.writeMin = d.min;
+	f.writeMax = d.max;
+	f.special = IonSysexField::PLAIN;
+	f.decodeMap = NULL;
+	f.encodeMap = NULL;
+	f.fxScoped = ((d.nrpn >= FX1_FIRST_NRPN) && (d.nrpn <= FX1_LAST_NRPN)) ||
+				 ((d.nrpn >= FX2_FIRST_NRPN) && (d.nrpn <= FX2_LAST_NRPN));
+
+	// handle the weird fx mix
+	if (d.offset == 2240) {
+		l_min = -100;
+		l_max = 100;
+		bits = 8;
+		f.special = IonSysexField::FX_MIX;
+	}
+	f.readMin = l_min;
+	f.readMax = l_max;
+
+	if (bits > 8) {
+		bits = 16;
+		f.hiByteOffset = f.byteOffset - 1;
+		f.mask = 0xffff;
+	} else if (bits < 8) {
+		if (l_min < 0) {
+			bits = 8;
 		} else {
-			s_value = 1;
+			f.shift = d.offset % 8;
+			f.mask = (1 << bits) - 1;
 		}
-    }
+	}
+	if (l_min < 0) {
+		f.signBit = 1 << (bits - 1);
+	}
+	f.partial = (bits < 8);
 
-    // fx2, sync param
-   if (m_offset == 1112) {
-	  s_value += 12;
-   }
-	// fx wet/dry mix
-   if (m_offset == 2240) {
-//	 s_value = (s_value*2)-100;
-	 s_value = (s_value*2);
-	 bits = 8;
-   }
+	// fx2, sync param
+	if (d.offset == 1112) {
+		f.bias = 12;
+	}
+	// handle the fm params - don't change order in XML file
+	if (d.offset == 282) {
+		f.special = IonSysexField::FM_ALGORITHM;
+	}
+	// osc sync param - don't change order in XML file
+	if (d.offset == 278) {
+		f.special = IonSysexField::OSC_SYNC;
+	}
+	if (d.offset == 152) {
+		f.special = IonSysexField::PORTAMENTO;
+	}
+	if (d.offset == 122) {
+		f.special = IonSysexField::UNISON;
+	}
 
-  // mod src 1336, 1344, 1352, ....
-  for (i = 0; i < 12; i++) {
-	  if (m_offset == (1336+(i*8))) {
-		s_value = mod_src_n_to_s[s_value];
-	  }
-	  // remap mod destinations 1432, 1440, ....
-	  if (m_offset == (1432+(i*8))) {
-		s_value = mod_dst_n_to_s[s_value];
-	  }
-  }
-  // filter offset 608, 616
-  for (i = 0; i < 2; i++) {
-	  if (m_offset == (608+(i*8))) {
-		s_value = filter_n_to_s[s_value];
-	  }
-  }
-  // s&h source 1168
-  if (m_offset == 1168) {
-	s_value = sh_n_to_s[s_value];
-  }
-  // tracking source 1912
-  if (m_offset == 1912) {
-	s_value = tracking_n_to_s[s_value];
-  }
-  if (m_offset == 122) {
-		if (s_value > 0) {
-			setBit(buffer, 121, 0);
-			s_value--;
-		} else {
-			setBit(buffer, 121, 1);
+	// mod src 1336, 1344, 1352, .... and mod destinations 1432, 1440, ....
+	for (i = 0; i < 12; i++) {
+		if (d.offset == (1336+(i*8))) {
+			f.decodeMap = mod_src_s_to_n;
+			f.encodeMap = mod_src_n_to_s;
+		}
+		if (d.offset == (1432+(i*8))) {
+			f.decodeMap = mod_dst_s_to_n;
+			f.encodeMap = mod_dst_n_to_s;
 		}
 	}
-
-   if(bits >= 8 || m_min < 0){
-        // write low byte
-        tmp = (unsigned char)(s_value & 0x00ff);
-        buffer[byte_offset] = tmp;
-        logDebug(">=8 || m_min < 0");
-
-    }
-
-    if(bits > 8){
-        tmp = (unsigned char)((s_value >> 8) & 0x00ff);
-        buffer[byte_offset - 1] = tmp;
-        logDebug(">=8 || m_min < 0");
-    }
-    if((bits < 8) && (m_min >= 0)){
-        unsigned char mask = ((1<<bits) - 1) << (m_offset % 8);
-        tmp = buffer[byte_offset];
-        tmp = (tmp & (~mask & 0xff)) | (s_value << (m_offset % 8));
-        buffer[byte_offset] = tmp;
-        logDebug(">=8 || m_min < 0");
-    }
-   return true;
+	// filter offset 608, 616
+	for (i = 0; i < 2; i++) {
+		if (d.offset == (608+(i*8))) {
+			f.decodeMap = filter_s_to_n;
+			f.encodeMap = filter_n_to_s;
+		}
+	}
+	// s&h source 1168
+	if (d.offset == 1168) {
+		f.decodeMap = sh_s_to_n;
+		f.encodeMap = sh_n_to_s;
+	}
+	// tracking source 1912
+	if (d.offset == 1912) {
+		f.decodeMap = tracking_s_to_n;
+		f.encodeMap = tracking_n_to_s;
+	}
+	return true;
 }
 
-bool IonSysexParam::setValueFromContent(unsigned char *content)
+// bytes of the program a special field writes besides its own
+static int specialFieldBytes(int special, short *bytes)
 {
-   int i;
-   if (m_conv == TEXT_LABEL) {
-	  return true;
-   }
-   if(m_conv == NAME){
-      return true;
-   }
-   if (m_offset == -1) {
-      return true;
-   }
-
-   int bits = getBitWidth();
- 
-   // handle the weird fx mix
-   int l_min = m_min;
-   int l_max = m_max;
-   if (m_offset == 2240) {
-	  l_min = -100;
-	  l_max = 100;
-	  bits = 8;
-   }
-  int byte_offset = m_offset / 8;
-   int result;
-   // Read low byte
-   result = (int)content[byte_offset];
-   if(bits > 8){
-      // Read high byte
-      bits = 16;
-      result += 256 * (int)content[byte_offset - 1];
-   }
-   else if(bits < 8){
-      if(l_min < 0)
-         bits = 8;
-      else{
-         result >>= m_offset % 8;
-         result &= ((1 << bits) - 1);
-      }
-   }
-   if(l_min < 0 && (result & (1 << (bits - 1)))){
-      result = -(-result & ((1 << bits) - 1));
-   }
+	switch (special) {
+		case IonSysexField::FM_ALGORITHM:
+			bytes[0] = 295/8;
+			return 1;
+		case IonSysexField::OSC_SYNC:
+			bytes[0] = 279/8;
+			bytes[1] = 280/8;
+			return 2;
+		case IonSysexField::PORTAMENTO:
+			bytes[0] = 135/8;
+			return 1;
+		case IonSysexField::UNISON:
+			bytes[0] = 121/8;
+			return 1;
+	}
+	return 0;
+}
 
-   // fx2, sync param
-   if (m_offset == 1112) {
-	  result -= 12;
-   }
+static inline int decodeField(const IonSysexField &f, const unsigned char *content)
+{
+	int result = content[f.byteOffset];
+	if (f.hiByteOffset >= 0) {
+		result += 256 * (int)content[f.hiByteOffset];
+	}
+	result = (result >> f.shift) & f.mask;
+	if (result & f.signBit) {
+		result -= f.signBit << 1;
+	}
+	result -= f.bias;
 
-   if(result < l_min)
-      result = l_min;
-   if(result > l_max)
-      result = l_max;
+	if (result < f.readMin)
+		result = f.readMin;
+	if (result > f.readMax)
+		result = f.readMax;
 
-   // handle weird cases
-   // handle the fm params - don't change order in XML file
-   if (m_offset == 282) {
-	int fm_type = getBit(295)*3;
-	result = (result & 0x3)  + fm_type;
-   }
- 
-   // osc sync param - don't change order in XML file
-   if (m_offset == 278) {
-	// 0: off, 1: hard 2->1, 2: hard 2+3->1, 3: soft 2->1, 4: soft 2+3->1
-	int sync_onoff =  getBit(278);
-	int sync_type = getBit(280);
-	sync_type = (sync_type == 0) ? 1 : 0;
-	int sync_route = getBit(279);
-	if (sync_onoff == 1) {
-	    result = 0;
-	} else {
-		result = sync_type*2 + sync_route + 1;
+	if (f.special != IonSysexField::PLAIN) {
+		result = decodeSpecialField(f.special, result, content);
 	}
-   }
-
-   // portamento params
-   if (m_offset == 152) {
-	if (getBit(135) == 0) {
-		result = result+1;
-	} else {
-		result = 0;
+	if (f.decodeMap) {
+		result = f.decodeMap[result];
 	}
-   }
+	return result - f.cntrlOffset;
+}
 
-   // unison
-   if (m_offset == 122) {
-	if (getBit(121) == 0) {
-		result = result+1;
-	} else {
-		result = 0;
+static inline void encodeField(const IonSysexField &f, int value, unsigned char *buffer)
+{
+	short s_value = (short) value;
+	s_value += f.cntrlOffset;
+	if (s_value < f.writeMin)
+		s_value = f.writeMin;
+	if (s_value > f.writeMax)
+		s_value = f.writeMax;
+
+	if (f.special != IonSysexField::PLAIN) {
+		s_value = encodeSpecialField(f.special, s_value, buffer);
+	}
+	s_value += f.bias;
+	if (f.encodeMap) {
+		s_value = f.encodeMap[s_value];
 	}
-   }
-   
-   // fx wet dry all screwed up!
-   if (m_offset == 2240) {
-//	 result = (result+100)/2;
-	 result = result/2;
-   }
-   // fx1, sync param
-   if (m_offset == 2304) {
-	  // printf("%d\n", result);
-	  // result -= 12;
-   }
 
-  // remap mod destinations
-  for (i = 0; i < 12; i++) {
-	  if (m_offset == (1432+(i*8))) {
-		result = mod_dst_s_to_n[result];
-	  }
-	  if (m_offset == (1336+(i*8))) {
-		result = mod_src_s_to_n[result];
-	  }
-  }
-  for (i = 0; i < 2; i++) {
-	  if (m_offset == (608+(i*8))) {
-		result = filter_s_to_n[result];
-	  }
-  }
-  if (m_offset == 1168) {
-	result = sh_s_to_n[result];
-  }
-  // tracking source 1912
-  if (m_offset == 1912) {
-	result = tracking_s_to_n[result];
-  }
-   m_value = result - m_cntrlOffset;
-   //cout << "m_value was " << result << endl;
-   //
-   m_valueSet = true;
-   return true;
+	if (f.partial) {
+		unsigned char mask = f.mask << f.shift;
+		unsigned char tmp = buffer[f.byteOffset];
+		buffer[f.byteOffset] = (tmp & (~mask & 0xff)) | (s_value << f.shift);
+		return;
+	}
+	buffer[f.byteOffset] = (unsigned char)(s_value & 0x00ff);
+	if (f.hiByteOffset >= 0) {
+		buffer[f.hiByteOffset] = (unsigned char)((s_value >> 8) & 0x00ff);
+	}
 }
 
 IonSysexParam::Conversion IonSysexParam::getConversionType()
 {
-   return m_conv;
+   return m_desc->conv;
 }
 
-vector<ListItemParameter> & IonSysexParam::getList()
+const vector<ListItemParameter> & IonSysexParam::getList()
 {
-   return m_list;
-}
-
-void IonSysexParam::appendToList(ListItemParameter value)
-{
-    m_list.push_back(value);
+   return m_owner->schema.getList(m_index);
 }
 
 /*
@@ -798,91 +807,62 @@ bool IonSysexParam::setList(string list)
 }
 */
 
-bool IonSysexParam::setConversion(Conversion conv)
-{
-   m_conv = conv;
-   return true;
-}
-
-bool IonSysexParam::setMin(int min)
-{
-   m_min = min;
-   
-   return true;
-}
-
-bool IonSysexParam::setMax(int max)
-{
-   m_max = max;
-   return true;
-}
-
-bool IonSysexParam::setOffset(int offset)
-{
-   m_offset = offset;
-   return true;
-}
-
-void IonSysexParam::setCntrlOffset(int offset)
-{
-   m_cntrlOffset = offset;
-}
-
 int IonSysexParam::getCntrlOffset()
 {
-	return m_cntrlOffset;
+	return m_desc->cntrlOffset;
 }
 
 int IonSysexParam::getNrpn() const
 { 
-    return m_nrpn; 
+    return m_desc->nrpn; 
 }
 
 int IonSysexParam::getNrpnValue()
 {
     int v = getValue();
-    if(m_conv == LIST){
-        if(m_list[v].hasSpecialNrpnValue()){
-            return m_list[v].getNrpnValue();
+    if(m_desc->conv == LIST){
+        const ListItemParameter &item = getList()[v];
+        if(item.hasSpecialNrpnValue()){
+            return item.getNrpnValue();
         }
     }
-    return m_value;
+    return v;
 }
 
 bool IonSysexParam::hasNrpn() 
 { 
-    return (m_nrpn > 0 ? true : false); 
+    return (m_desc->nrpn > 0 ? true : false); 
 }
 
 bool IonSysexParam::isFxSelector() const {
-	if ((m_nrpn == FX1_SELECTOR) || (m_nrpn == FX2_SELECTOR)) {
+	if ((m_desc->nrpn == FX1_SELECTOR) || (m_desc->nrpn == FX2_SELECTOR)) {
 		return true;
 	}
 	return false;
 }
 
 bool IonSysexParam::isTrackingGenValue() const {
-	return (m_nrpn >= 633 && m_nrpn <= 633+32);
+	return (m_desc->nrpn >= 633 && m_desc->nrpn <= 633+32);
 }
 
 bool IonSysexParam::isMatrixSource() const {
-	return (m_nrpn >= 692 && m_nrpn <= 736 && (m_nrpn & 0x3) == 0x0);
+	return (m_desc->nrpn >= 692 && m_desc->nrpn <= 736 && (m_desc->nrpn & 0x3) == 0x0);
 }
 
 bool IonSysexParam::isMatrixDest() const {
-	return (m_nrpn >= 693 && m_nrpn <= 737 && (m_nrpn & 0x3) == 0x1);
+	return (m_desc->nrpn >= 693 && m_desc->nrpn <= 737 && (m_desc->nrpn & 0x3) == 0x1);
 }
 
 bool IonSysexParam::isModLevel() const {
-	return (m_nrpn >= 694 && m_nrpn <= 738 && (m_nrpn & 0x3) == 0x2);
+	return (m_desc->nrpn >= 694 && m_desc->nrpn <= 738 && (m_desc->nrpn & 0x3) == 0x2);
 }
 
 bool IonSysexParam::isModOffset() const {
-	return (m_nrpn >= 695 && m_nrpn <= 739 && (m_nrpn & 0x3) == 0x3);
+	return (m_desc->nrpn >= 695 && m_desc->nrpn <= 739 && (m_desc->nrpn & 0x3) == 0x3);
 }
 
-SInt32 IonSysexParam::fxSelectorToNrpn() {
-	switch (m_nrpn) {
+int32 IonSysexParam::fxSelectorToNrpn() {
+	switch (m_desc->nrpn) {
         case FX1_SELECTOR:
             return 743;
             break;
@@ -898,44 +878,36 @@ SInt32 IonSysexParam::fxSelectorToNrpn() {
 
 IonSysexParam * IonSysex::getParamByName(string paramName)
 {
-#if 0
-    for(int i = 0; i < params.params.size(); i++){
-		if (!params.params[i]->getParamName().empty() &&
-			(params.params[i]->getParamName() == paramName)) {
-			return params.params[i];
-		}
-        if(paramName == params.params[i]->getName())
-            return params.params[i];
-    }
-#endif
-    return NULL;
+    return params.getParamByName(String(paramName.c_str()));
 }
 
 void IonSysexParam::printDebug()
 {
-   cout << "name: " << m_name << endl;
-   cout << "min,max:" << m_min << "," << m_max << endl;
-   if(m_list.size() > 0){
+   cout << "name: " << m_desc->name << endl;
+   cout << "min,max:" << m_desc->min << "," << m_desc->max << endl;
+   if(getList().size() > 0){
       //cout << "list: " << m_list[0];;
-      for(unsigned int j = 1; j < m_list.size() ; j++){
+      for(unsigned int j = 1; j < getList().size() ; j++){
 //         cout << ", " << m_list[j];
       }
       cout << endl;
       //cout << "value:" << m_list[m_value] << endl;
-   }else if(m_conv == NAME){
-      cout << "value: " << String(m_textValue)  << endl;
+   }else if(m_desc->conv == NAME){
+      cout << "value: " << getTextValue()  << endl;
    }else{
-      cout << "value:" << m_value << endl;
+      cout << "value:" << getValue() << endl;
    }
    cout << "--------------------------------" << endl;
 }
 
 ////// IonSysexParams
 
-IonSysexParams::IonSysexParams()
+IonSysexParams::IonSysexParams() :
+    schema(IonSysexSchema::get())
 {
 	fx1Param = 0;
 	fx2Param = 0;
+	memset(m_prog_name, 0, sizeof(m_prog_name));
    /*
    IonSysexParam *param;
 
@@ -949,218 +921,418 @@ IonSysexParams::IonSysexParams()
 
 #include "params.def"
 */
-    initFromXml();
+    int n = schema.numParams();
+    params.reserve(n);
+    values.resize(n);
+    for (int i = 0; i < n; i++) {
+        params.push_back(IonSysexParam(this, i));
+        values[i] = (int16) schema.getDesc(i).min;
+    }
+    int idx = schema.indexOfNrpn(FX1_SELECTOR);
+    if (idx >= 0) {
+        fx1Param = &params[idx];
+    }
+    idx = schema.indexOfNrpn(FX2_SELECTOR);
+    if (idx >= 0) {
+        fx2Param = &params[idx];
+    }
 
+    dirtyParams.assign((n + 63) / 64, 0);
+    pendingParams.assign(dirtyParams.size(), 0);
+    byteGroupStamp.assign(schema.byteGroups.size(), 0);
+    imageStamp = 0;
+    imageStale = true;
+    routing[0].assign(n, NO_NRPN);
+    routing[1].assign(n, NO_NRPN);
+    routingActive = 0;
+    routingStale = 1;
+    nameDirty = false;
 }
-void IonSysexParams::initFromXml()
+
+////// IonSysexSchema
+
+const IonSysexSchema &IonSysexSchema::get()
 {
-    int sz;
-    const char *xml = BinaryData::getNamedResource("parameters_xml", sz);
-    TiXmlDocument doc;
-    if(!doc.Parse(xml)){
-        logDebug("Unable to parse parameters.xml");
-        return;
+    static const IonSysexSchema schema;
+    return schema;
+}
+
+const IonSysexParamDesc &IonSysexSchema::getDesc(int idx) const
+{
+    return paramTable[idx];
+}
+
+int IonSysexSchema::indexOfNrpn(int nrpn) const
+{
+    if ((nrpn < 0) || (nrpn >= (int) byNrpn.size())) {
+        return -1;
     }
-    TiXmlElement *rootElement = doc.RootElement();
-	TiXmlNode *pParamNode = NULL;
-    for(pParamNode = rootElement->FirstChild(); pParamNode != 0; pParamNode = pParamNode->NextSibling()) {
-		IonSysexParam *param;
-		const char *paramName;
-		bool isList = false;
-		if(string(pParamNode->Value()) != "parameter"){
-			logDebug("One of the root children was not a parameter node. Aborting");
-			return;
-		}
-		TiXmlAttribute *pParamAttrib = pParamNode->ToElement()->FirstAttribute();
-		if(string(pParamAttrib->Name()) != "name"){
-			logDebug("First attribute of parameter element not name. Aborting");
-			return;
-		}else{
-			paramName = pParamAttrib->Value();
-		}
-		params.push_back(new IonSysexParam(strdup(paramName)));
-		param = params[params.size() - 1];
-		pParamAttrib = pParamAttrib->Next();
-		while(pParamAttrib != 0){
-			if(string(pParamAttrib->Name()) == "conversion"){
-				string convString = string(pParamAttrib->Value());
-				if(convString == "NONE")
-					param->setConversion(IonSysexParam::NONE);
-				else if(convString == "LIST"){
-					param->setConversion(IonSysexParam::LIST);
-					isList = true;
-				} 
-				else if(convString == "PERCENT")
-					param->setConversion(IonSysexParam::PERCENT);
-				else if(convString == "TENTHS_OF_PERCENT")
-					param->setConversion(IonSysexParam::TENTHS_OF_PERCENT);
-				else if(convString == "INT32")
-					param->setConversion(IonSysexParam::INT32);
-				else if(convString == "INT16")
-					param->setConversion(IonSysexParam::INT16);
-				else if(convString == "ENV_TIME")
-					param->setConversion(IonSysexParam::ENV_TIME);
-				else if(convString == "FX1_FX2_BALANCE")
-					param->setConversion(IonSysexParam::FX1_FX2_BALANCE);
-				else if(convString == "FILTER_FREQ")
-					param->setConversion(IonSysexParam::FILTER_FREQ);
-				else if(convString == "PITCH_FINE")
-					param->setConversion(IonSysexParam::PITCH_FINE);
-				else if(convString == "PORTA_TIME")
-					param->setConversion(IonSysexParam::PORTA_TIME);
-				else if(convString == "LFO_FREQ")
-					param->setConversion(IonSysexParam::LFO_FREQ);
-				else if(convString == "FX_LFO_FREQ")
-					param->setConversion(IonSysexParam::FX_LFO_FREQ);
-				else if(convString == "MS")
-					param->setConversion(IonSysexParam::MS);
-				else if(convString == "RELEASE_TIME")
-					param->setConversion(IonSysexParam::RELEASE_TIME);
-				else if(convString == "FILTER_OFFSET_FREQ")
-					param->setConversion(IonSysexParam::FILTER_OFFSET_FREQ);
-				else if(convString == "FILTER_OFFSET_OCT")
-					param->setConversion(IonSysexParam::FILTER_OFFSET_OCT);
-				else if(convString == "BALANCE")
-					param->setConversion(IonSysexParam::BALANCE);
-				else if(convString == "TENTHS")
-					param->setConversion(IonSysexParam::TENTHS);
-				else if(convString == "NAME")
-					param->setConversion(IonSysexParam::NAME);
-				else if(convString == "WET_DRY")
-					param->setConversion(IonSysexParam::WET_DRY);
-				else if(convString == "PRE_BAL")
-					param->setConversion(IonSysexParam::PRE_BAL);
-				else if(convString == "POST_BAL")
-					param->setConversion(IonSysexParam::POST_BAL);
-				else if(convString == "BANK")
-					param->setConversion(IonSysexParam::BANK);
-				else if(convString == "EXT_IN")
-					param->setConversion(IonSysexParam::EXT_IN);
-				else if(convString == "OCTAVE")
-					param->setConversion(IonSysexParam::OCTAVE);
-				else if(convString == "SEMITONE")
-					param->setConversion(IonSysexParam::SEMITONE);
-				else if(convString == "TEXT_LABEL")
-					param->setConversion(IonSysexParam::TEXT_LABEL);
-			}else if(string(pParamAttrib->Name()) == "min"){
-				int min;
-				if(pParamAttrib->QueryIntValue(&min) != TIXML_SUCCESS){
-					logDebug("Error parsing min attribute");
-				}
-				param->setMin(min);
-			}else if(string(pParamAttrib->Name()) == "max"){
-				int max;
-				if(pParamAttrib->QueryIntValue(&max) != TIXML_SUCCESS){
-					logDebug("Error parsing max attribute");
-				}
-				param->setMax(max);
-			}else if(string(pParamAttrib->Name()) == "sysexoffset"){
-				int sysexoffset;
-				if(pParamAttrib->QueryIntValue(&sysexoffset) != TIXML_SUCCESS){
-					logDebug("Error parsing sysexoffset attribute");
-				}
-				param->setOffset(sysexoffset);
-			} else if(string(pParamAttrib->Name()) == "defaultval"){
-				int defaultval;
-				if(pParamAttrib->QueryIntValue(&defaultval) != TIXML_SUCCESS){
-					logDebug("Error parsing defaultval attribute");
-				}
-				param->setDefaultValue(defaultval);
-			}else if(string(pParamAttrib->Name()) == "nrpn"){
-				int nrpn;
-				if(pParamAttrib->QueryIntValue(&nrpn) != TIXML_SUCCESS){
-					logDebug("Error parsing nrpn attribute");
-				}
-                if (nrpn == FX1_SELECTOR) {
-                    fx1Param = param;
-                }
-                if (nrpn == FX2_SELECTOR) {
-                    fx2Param = param;
-                }
-				param->setNrpn(nrpn);
-			}else if(string(pParamAttrib->Name()) == "cntrloffset"){
-				int offset;
-				// how much to add to nrpn value before sending to controller.
-				// added to help the fact that bcr2000 doesn't handle negative value well
-				if(pParamAttrib->QueryIntValue(&offset) != TIXML_SUCCESS){
-				   logDebug("Error parsing nrpn attribute");
-				}
-				param->setCntrlOffset(offset);
-			} else if(string(pParamAttrib->Name()) == "paramname"){
-				// how much to add to nrpn value before sending to controller.
-				// added to help the fact that bcr2000 doesn't handle negative value well
-			   param->setParamName(pParamAttrib->Value());
-			}
-			
+    return byNrpn[nrpn];
+}
 
-			pParamAttrib = pParamAttrib->Next();
+int IonSysexSchema::indexOfOffset(int sysexoffset) const
+{
+    if ((sysexoffset < 0) || (sysexoffset >= (int) byOffset.size())) {
+        return -1;
+    }
+    return byOffset[sysexoffset];
+}
 
-		}
-		// Read the listitems
-		if(isList){
-			TiXmlNode *pListItemNode = NULL;
-			for(pListItemNode = pParamNode->FirstChild(); pListItemNode != 0; pListItemNode = pListItemNode->NextSibling()){
-				if(string(pListItemNode->Value()) != "listitem"){
-					logDebug("One of the root children was not a parameter node. Aborting");
-					return;
-				}
-				TiXmlAttribute *pListItemAttrib = pListItemNode->ToElement()->FirstAttribute();
-				if(pListItemAttrib == NULL){
-					logDebug("listitem element with no attributes");
-				}else{
-					const char *listItemName = "";
-					bool disableListItem = false;
-					bool hasSpecialNrpn = false;
-					int nrpnValue = 0;
-
-					while(pListItemAttrib != NULL){
-						if(string(pListItemAttrib->Name()) == "name"){
-							listItemName = strdup(pListItemAttrib->Value());
-						}else if(string(pListItemAttrib->Name()) == "disable"){
-							if(string(pListItemAttrib->Value()) == "true")
-								disableListItem = true;
-						}else if(string(pListItemAttrib->Name()) == "nrpnvalue"){
-							if(pListItemAttrib->QueryIntValue(&nrpnValue) != TIXML_SUCCESS){
-								logDebug("nrpn attribute ok, but couldn't parse value");
-							}else{
-								hasSpecialNrpn = true;
-							}
-
-						}
-						pListItemAttrib = pListItemAttrib->Next();
-					}
-					ListItemParameter listItemParam(listItemName);
-					if(disableListItem)
-						listItemParam.setEnabled(false);
-					if(hasSpecialNrpn)
-						listItemParam.setSpecialNrpnValue(nrpnValue);
-
-					param->appendToList(listItemParam);    
-				}
-			}
-		}
-	}
-} 
+int IonSysexSchema::nextAtOffset(int idx) const
+{
+    return sameOffset[idx];
+}
+
+int IonSysexSchema::indexOfName(const String &name) const
+{
+    return byName.contains(name) ? byName[name] : -1;
+}
+
+IonSysexSchema::~IonSysexSchema()
+{
+}
+
+// the table for a list parameter is its own, the others share one per conversion
+const IonSysexSchema::ValueTextTable *IonSysexSchema::getTextTable(int idx) const
+{
+    ValueTextTable *table = textOfParam[idx].get();
+    if (table) {
+        return table;
+    }
+
+    const ScopedLock lock(textLock);
+    const IonSysexParamDesc &d = paramTable[idx];
+    if (lists[idx].size() != 0) {
+        table = new ValueTextTable();
+        table->first = 0;
+        for (unsigned int i = 0; i < lists[idx].size(); i++) {
+            table->texts.push_back(String(lists[idx][i].getName()));
+        }
+    } else if (textOfConv[d.conv]) {
+        table = textOfConv[d.conv];
+    } else {
+        char buf[128];
+        table = new ValueTextTable();
+        table->first = convMin[d.conv];
+        for (int val = convMin[d.conv]; val <= convMax[d.conv]; val++) {
+            IonSysexParam::formatValue(d.conv, val, buf);
+            table->texts.push_back(String(buf));
+        }
+        textOfConv[d.conv] = table;
+    }
+    if (!textTables.contains(table)) {
+        // first one wins when two values format the same
+        for (int i = (int) table->texts.size() - 1; i >= 0; i--) {
+            table->values.set(table->texts[i].trim(), table->first + i);
+        }
+        textTables.add(table);
+    }
+    textOfParam[idx] = table;
+    return table;
+}
+
+const String *IonSysexSchema::findValueText(int idx, int value) const
+{
+    const ValueTextTable *table = getTextTable(idx);
+    int i = value + paramTable[idx].cntrlOffset - table->first;
+    if ((i < 0) || (i >= (int) table->texts.size())) {
+        return NULL;
+    }
+    return &table->texts[i];
+}
+
+bool IonSysexSchema::findTextValue(int idx, const String &text, int &value) const
+{
+    const IonSysexParamDesc &d = paramTable[idx];
+    const ValueTextTable *table = getTextTable(idx);
+    String t = text.trim();
+    int val;
+    if (table->values.contains(t)) {
+        val = table->values[t];
+    } else if (t.isNotEmpty() && t.substring(t[0] == '-' ? 1 : 0).containsOnly("0123456789")) {
+        // plain numbers are taken as they are
+        val = t.getIntValue();
+    } else {
+        return false;
+    }
+    if ((val < d.min) || (val > d.max)) {
+        return false;
+    }
+    value = val - d.cntrlOffset;
+    return true;
+}
+
+static int findGroupRoot(vector<int> &parent, int i)
+{
+    while (parent[i] != i) {
+        i = parent[i] = parent[parent[i]];
+    }
+    return i;
+}
+
+IonSysexSchema::IonSysexSchema()
+{
+    int i;
+    count = NUM_PARAMS;
+    lists.resize(count);
+    textOfParam.resize(count);
+    for (i = 0; i < IonSysexParam::NUM_CONVERSIONS; i++) {
+        convMin[i] = 0;
+        convMax[i] = -1;
+        textOfConv[i] = NULL;
+    }
+    sameOffset.assign(count, -1);
+    fieldOfParam.assign(count, -1);
+    vector<short> lastAtOffset;
+    for (i = 0; i < count; i++) {
+        const IonSysexParamDesc &d = paramTable[i];
+        lists[i].assign(paramListItems + d.firstListItem, paramListItems + d.firstListItem + d.numListItems);
+        if (d.numListItems == 0) {
+            if (convMin[d.conv] > convMax[d.conv]) {
+                convMin[d.conv] = d.min;
+                convMax[d.conv] = d.max;
+            }
+            convMin[d.conv] = jmin(convMin[d.conv], d.min);
+            convMax[d.conv] = jmax(convMax[d.conv], d.max);
+        }
+        if (d.nrpn >= 0) {
+            if (d.nrpn >= (int) byNrpn.size()) {
+                byNrpn.resize(d.nrpn + 1, -1);
+            }
+            if (byNrpn[d.nrpn] < 0) {
+                byNrpn[d.nrpn] = i;
+            }
+        }
+        if (d.offset >= 0) {
+            if (d.offset >= (int) byOffset.size()) {
+                byOffset.resize(d.offset + 1, -1);
+                lastAtOffset.resize(d.offset + 1, -1);
+            }
+            if (byOffset[d.offset] < 0) {
+                byOffset[d.offset] = i;
+            } else {
+                sameOffset[lastAtOffset[d.offset]] = i;
+            }
+            lastAtOffset[d.offset] = i;
+        }
+        // the first parameter called so wins, by paramname before name
+        if (d.paramName && !byName.contains(d.paramName)) {
+            byName.set(d.paramName, i);
+        }
+        if (!byName.contains(d.name)) {
+            byName.set(d.name, i);
+        }
+    }
+
+    IonSysexField f;
+    for (i = 0; i < count; i++) {
+        if (describeField(i, f)) {
+            fieldOfParam[i] = layout.size();
+            layout.push_back(f);
+            if (paramTable[i].conv != IonSysexParam::NAME) {
+                hashedParams.push_back(i);
+            }
+        }
+    }
+
+    // group together fields that share any byte of the program
+    vector<int> parent(layout.size());
+    vector<int> byteOwner(SYSEX_RAW_SIZE, -1);
+    vector< vector<short> > fieldBytes(layout.size());
+    for (unsigned int i = 0; i < layout.size(); i++) {
+        short extra[2];
+        int n = specialFieldBytes(layout[i].special, extra);
+        parent[i] = i;
+        fieldBytes[i].push_back(layout[i].byteOffset);
+        if (layout[i].hiByteOffset >= 0) {
+            fieldBytes[i].push_back(layout[i].hiByteOffset);
+        }
+        fieldBytes[i].insert(fieldBytes[i].end(), extra, extra + n);
+        for (unsigned int j = 0; j < fieldBytes[i].size(); j++) {
+            int b = fieldBytes[i][j];
+            if (byteOwner[b] < 0) {
+                byteOwner[b] = i;
+            } else {
+                parent[findGroupRoot(parent, i)] = findGroupRoot(parent, byteOwner[b]);
+            }
+        }
+    }
+    vector<int> groupOfRoot(layout.size(), -1);
+    byteGroups.clear();
+    byteGroupOfField.resize(layout.size());
+    for (unsigned int i = 0; i < layout.size(); i++) {
+        int root = findGroupRoot(parent, i);
+        if (groupOfRoot[root] < 0) {
+            groupOfRoot[root] = byteGroups.size();
+            byteGroups.push_back(ByteGroup());
+        }
+        ByteGroup &g = byteGroups[groupOfRoot[root]];
+        g.fields.push_back(i);
+        g.bytes.insert(g.bytes.end(), fieldBytes[i].begin(), fieldBytes[i].end());
+        byteGroupOfField[i] = groupOfRoot[root];
+    }
+    for (unsigned int i = 0; i < byteGroups.size(); i++) {
+        vector<short> &b = byteGroups[i].bytes;
+        sort(b.begin(), b.end());
+        b.erase(unique(b.begin(), b.end()), b.end());
+    }
+}
+
+// MurmurHash64A, by Austin Appleby, public domain
+static uint64 hash64(const void *key, int len, uint64 seed)
+{
+    const uint64 m = 0xc6a4a7935bd1e995ULL;
+    const int r = 47;
+    uint64 h = seed ^ (len * m);
+    const unsigned char *data = (const unsigned char *) key;
+    const unsigned char *end = data + (len & ~7);
+
+    while (data != end) {
+        uint64 k;
+        memcpy(&k, data, 8);
+        data += 8;
+        k *= m;
+        k ^= k >> r;
+        k *= m;
+        h ^= k;
+        h *= m;
+    }
+    switch (len & 7) {
+        case 7: h ^= uint64(data[6]) << 48;   // fall through
+        case 6: h ^= uint64(data[5]) << 40;   // fall through
+        case 5: h ^= uint64(data[4]) << 32;   // fall through
+        case 4: h ^= uint64(data[3]) << 24;   // fall through
+        case 3: h ^= uint64(data[2]) << 16;   // fall through
+        case 2: h ^= uint64(data[1]) << 8;    // fall through
+        case 1: h ^= uint64(data[0]);
+                h *= m;
+    }
+    h ^= h >> r;
+    h *= m;
+    h ^= h >> r;
+    return h;
+}
 
+uint64 IonSysexSchema::canonicalHash(const int16 *values) const
+{
+    int16 payload[NUM_PARAMS];
+    int n = (int) hashedParams.size();
+    for (int i = 0; i < n; i++) {
+        payload[i] = values[hashedParams[i]];
+    }
+    return hash64(payload, n * (int) sizeof(int16), 0x6d6963726f6e4155ULL);
+}
+
+// unpacks the content of a program dump that passed checkProgramHeader() into raw, which
+// needs SYSEX_RAW_SIZE + 5 bytes, and gets the checksum stored in the header and the one
+// the content adds up to
+static void programChecksums(const unsigned char *program, unsigned char *raw, uint32 &stored, uint32 &actual)
+{
+   const unsigned char *header = program + 1 + 4 + sizeof(unsigned int);
+
+   // the checksum is in the second group of the packed header, big endian
+   unsigned char checksumGroup[7];
+   midiUnpack7(header + 8, checksumGroup, 1);
+   stored = toBigEndian(&checksumGroup[1]);
+
+   // programChecksum() reads whole words, so zero the end of the last one
+   midiUnpack7(header + sizeof(ProgramHeader), raw, SYSEX_ENCODED_SIZE / 8);
+   memset(&raw[SYSEX_RAW_SIZE], 0, 5);
+   actual = programChecksum(raw, SYSEX_RAW_SIZE);
+}
+
+ProgramStatus rechecksumProgram(unsigned char *program, int size)
+{
+   ProgramStatus status = checkProgramHeader(program, size);
+   if (status != PROGRAM_OK) {
+      return status;
+   }
+   unsigned char raw[SYSEX_RAW_SIZE + 5];
+   uint32 stored, actual;
+   programChecksums(program, raw, stored, actual);
+   if (stored == actual) {
+      return PROGRAM_OK;
+   }
+   unsigned char *group = program + 1 + 4 + sizeof(unsigned int) + 8;
+   unsigned char checksumGroup[7];
+   midiUnpack7(group, checksumGroup, 1);
+   uint32 n = ByteOrder::swapIfLittleEndian(actual);
+   memcpy(&checksumGroup[1], &n, 4);
+   midiPack7(checksumGroup, group, 1);
+   return PROGRAM_BAD_CHECKSUM;
+}
+
+void IonSysexSchema::decodeContent(const unsigned char *encoded, int16 *values, char *name) const
+{
+   unsigned char decodedContent[SYSEX_RAW_SIZE];
+   midiUnpack7(encoded, decodedContent, SYSEX_ENCODED_SIZE / 8);
+   decodeRaw(decodedContent, values, name);
+}
+
+void IonSysexSchema::decodeRaw(const unsigned char *decodedContent, int16 *values, char *name) const
+{
+   const IonSysexField *f = &layout[0];
+   const IonSysexField *end = f + layout.size();
+   for (; f != end; f++) {
+      values[f->paramIndex] = (int16) decodeField(*f, decodedContent);
+   }
+
+   memset(name, 0, 15);
+   strncpy(name, (const char *) &decodedContent[0], 14);
+}
+
+ProgramStatus IonSysexSchema::decodeProgram(const unsigned char *program, int size, int16 *values, char *name) const
+{
+   ProgramStatus status = checkProgramHeader(program, size);
+   if (status != PROGRAM_OK) {
+      return status;
+   }
+   unsigned char raw[SYSEX_RAW_SIZE + 5];
+   uint32 stored, actual;
+   programChecksums(program, raw, stored, actual);
+   if (stored != actual) {
+      return PROGRAM_BAD_CHECKSUM;
+   }
+   decodeRaw(raw, values, name);
+   return PROGRAM_OK;
+}
+
+void IonSysexParams::paramChanged(int idx)
+{
+    SpinLock::ScopedLockType lock(dirtyLock);
+    int nrpn = schema.getDesc(idx).nrpn;
+    if ((nrpn == FX1_SELECTOR) || (nrpn == FX2_SELECTOR)) {
+        // changes which fx fields are written at all, and where the fx parameters go
+        imageStale = true;
+        routingStale = 1;
+    } else {
+        dirtyParams[idx >> 6] |= (uint64) 1 << (idx & 63);
+    }
+}
 
 bool IonSysexParams::parseParamsFromContent(unsigned char *ptr, int contentSize)
 {
-   char buf[4];
+   return readProgramContent(ptr, contentSize);
+}
+
+bool IonSysexParams::readProgramContent(const unsigned char *ptr, int contentSize)
+{
+   if (contentSize < SYSEX_CONTENT_SIZE) {
+      logDebug("Sysex content too short");
+      return false;
+   }
    // header
-   memcpy(buf, ptr, sizeof(buf));
-   ptr += sizeof(buf);
-   if(buf[0] != 0x00 ||
-      buf[1] != 0x00 ||
-      buf[2] != 0x0e ||
-      buf[3] != 0x22)
+   if(ptr[0] != 0x00 ||
+      ptr[1] != 0x00 ||
+      ptr[2] != 0x0e ||
+      ptr[3] != 0x22)
    {
       logDebug("Invalid Sysex Header");
       return false;
    }
+   ptr += 4;
 
    // opcode
-   unsigned int n;
-   memcpy(&n, ptr, sizeof(unsigned int));
    ptr += sizeof(unsigned int);
    
    // program header
@@ -1168,45 +1340,45 @@ bool IonSysexParams::parseParamsFromContent(unsigned char *ptr, int contentSize)
    ptr += sizeof(ProgramHeader);
 
    // now comes the rest
-   // First, decode (shrink) then parse
-   vector <unsigned char> encoded;
-   vector <unsigned char> decoded;
-   for(int j = 0; j < 360; j++) encoded.push_back(ptr[j]);
-   decodeFromMidi(encoded, decoded);
-   unsigned char *decodedContent = new unsigned char[decoded.size()];
-   for (unsigned int i = 0; i < decoded.size(); i++) {
-	 decodedContent[i] = decoded[i];
-   }
+   schema.decodeContent(ptr, &values[0], m_prog_name);
 
-    for(unsigned int i = 0; i < params.size(); i++){
-      params[i]->setValueFromContent(decodedContent);
-	  if (params[i]->getNrpn() == FX1_SELECTOR) {
-		 fx1Param = params[i];
-	   }
-	  if (params[i]->getNrpn() == FX2_SELECTOR) {
-		 fx2Param = params[i];
-	   }
-//     params[i].printDebug();
-   }
-    
-   {
-        char name[15];
-        memset(name, 0, 15);
-        memcpy(name,&decodedContent[0],15);
-        name[14] = 0;
-        m_prog_name = String(name);
+   SpinLock::ScopedLockType lock(dirtyLock);
+   imageStale = true;
+   routingStale = 1;
+   return true;
+}
+
+String IonSysexParams::get_prog_name()
+{
+   return programNameToString(m_prog_name, sizeof(m_prog_name));
+}
+
+void IonSysexParams::set_prog_name(String s)
+{
+   // whole characters only, so a name cut at the limit is still valid utf-8
+   memset(m_prog_name, 0, sizeof(m_prog_name));
+   CharPointer_UTF8 c = s.toUTF8();
+   size_t n = 0;
+   while (! c.isEmpty()) {
+      size_t bytes = CharPointer_UTF8::getBytesRequiredFor(*c);
+      if (n + bytes > sizeof(m_prog_name) - 1) {
+         break;
+      }
+      n += bytes;
+      ++c;
    }
+   memcpy(m_prog_name, s.toRawUTF8(), n);
 
-   delete decodedContent;
-   return true;
+   SpinLock::ScopedLockType lock(dirtyLock);
+   nameDirty = true;
 }
 
 // we assign each fx parameter a different nrpn so that we can have a different GUI element controlling it.
 // this function maps those nrpns back to the ones expected by the micron
-SInt32 IonSysexParams::fx1fx2NrpnNum(IonSysexParam *p)
+int32 IonSysexParams::fx1fx2NrpnNum(IonSysexParam *p)
 {
-	SInt32 nrpn = p->getNrpn();
-	SInt32 fx = p->fxSelectorToNrpn();
+	int32 nrpn = p->getNrpn();
+	int32 fx = p->fxSelectorToNrpn();
 	if (fx != -1) {
 		// paramater is a selector
 		return fx;
@@ -1228,31 +1400,33 @@ SInt32 IonSysexParams::fx1fx2NrpnNum(IonSysexParam *p)
 	return nrpn;
 }
 
-SInt32 IonSysexParam::fxMin()
+int32 IonSysexParam::fxMin()
 {
-	if (m_nrpn == FX1_SELECTOR) {
-		return m_value*10+FX1_FIRST_NRPN;
+	if (m_desc->nrpn == FX1_SELECTOR) {
+		return getValue()*10+FX1_FIRST_NRPN;
 	}
-	if (m_nrpn == FX2_SELECTOR) {
-		return m_value*5+FX2_FIRST_NRPN;
+	if (m_desc->nrpn == FX2_SELECTOR) {
+		return getValue()*5+FX2_FIRST_NRPN;
 	}
 	return -1;
 }
 
-SInt32 IonSysexParam::fxMax()
+int32 IonSysexParam::fxMax()
 {
-	if (m_nrpn == FX1_SELECTOR) {
+	if (m_desc->nrpn == FX1_SELECTOR) {
 		return 10;
 	}
-	if (m_nrpn == FX2_SELECTOR) {
+	if (m_desc->nrpn == FX2_SELECTOR) {
 		return 5;
 	}
 	return -1;
 }
 
-bool IonSysexParams::shouldSkipFx1(IonSysexParam *p) {
-	SInt32 nrpn = p->getNrpn();
-	SInt32 selectedFxType = fx1Param->getValue()*10 + FX1_FIRST_NRPN;
+bool IonSysexParams::shouldSkipFx1(int nrpn) {
+	if (!fx1Param) {
+		return false;
+	}
+	int32 selectedFxType = fx1Param->getValue()*10 + FX1_FIRST_NRPN;
 	if ((nrpn < FX1_FIRST_NRPN) || (nrpn > FX1_LAST_NRPN)) {
 		return false;
 	}
@@ -1263,12 +1437,11 @@ bool IonSysexParams::shouldSkipFx1(IonSysexParam *p) {
 	return false;
 }
 
-bool IonSysexParams::shouldSkipFx2(IonSysexParam *p) {
-	SInt32 nrpn = p->getNrpn();
+bool IonSysexParams::shouldSkipFx2(int nrpn) {
 	if (!fx2Param || (fx2Param->getValue() == 0)) {
 		return false;
 	}
-	SInt32 selectedFxType = (fx2Param->getValue()-1)*5 + FX2_FIRST_NRPN;
+	int32 selectedFxType = (fx2Param->getValue()-1)*5 + FX2_FIRST_NRPN;
 	if ((nrpn < FX2_FIRST_NRPN) || (nrpn > FX2_LAST_NRPN)) {
 		return false;
 	}
@@ -1279,56 +1452,116 @@ bool IonSysexParams::shouldSkipFx2(IonSysexParam *p) {
 	return false;
 }
 
+void IonSysexParams::rebuildRouting()
+{
+    SpinLock::ScopedLockType lock(routingLock);
+    // cleared first, so a selector change that races with us makes the next call rebuild
+    // again. already clear means another caller rebuilt while we waited for the lock.
+    if (! routingStale.compareAndSetBool(0, 1)) {
+        return;
+    }
+    vector<short> &next = routing[1 - routingActive.get()];
+    for (unsigned int i = 0; i < params.size(); i++) {
+        IonSysexParam *p = &params[i];
+        int nrpn = NO_NRPN;
+        if (p->hasNrpn()) {
+            nrpn = fx1fx2NrpnNum(p);
+            if (shouldSkipFx1(p) || shouldSkipFx2(p) || (nrpn >= 2048)) {
+                nrpn = NO_NRPN;
+            } else if (nrpn >= 512) {
+                nrpn -= 512;
+            }
+        }
+        next[i] = (short) nrpn;
+    }
+    routingActive = 1 - routingActive.get();
+}
+
 IonSysexParams::~IonSysexParams()
 {
-        for(unsigned int i = 0; i < params.size(); i++) delete params[i];
 }
 
-IonSysexParam *IonSysexParams::getParam(UInt32 idx)
+IonSysexParam *IonSysexParams::getParam(uint32 idx)
+{
+	return &params[idx];
+}
+
+IonSysexParam *IonSysexParams::getParamByNrpn(int nrpn)
 {
-	return params[idx];
+	int idx = schema.indexOfNrpn(nrpn);
+	return (idx < 0) ? NULL : &params[idx];
+}
+
+IonSysexParam *IonSysexParams::getParamByName(const String &name)
+{
+	int idx = schema.indexOfName(name);
+	return (idx < 0) ? NULL : &params[idx];
 }
 
 bool IonSysexParams::getAsSysexMessage(unsigned char* sysexBuf)
 {
-    unsigned char *bufPtr = sysexBuf;
-    SysexHeader sysexHeader;
-	UInt32 cs;
-    // Buffer is 315 chars, which is encoded
-    // The raw buffer is 315 + (315 / 7) bytes long
-    unsigned char *rawContent = new unsigned char[350];
-    for(int i = 0; i < 350; i++) rawContent[i] = 0;
-    // first write to a buffer (of 315) then expand
-    for(unsigned int i = 0; i < params.size(); i++){
-		if (shouldSkipFx1(params[i])) {
-			continue;
-		}
-		if (shouldSkipFx2(params[i])) {
+    return writeProgram(sysexBuf, SYSEX_PROGRAM_SIZE);
+}
+
+bool IonSysexParams::writeProgram(unsigned char *sysexBuf, int size)
+{
+    if (size < SYSEX_PROGRAM_SIZE) {
+        return false;
+    }
+    const ScopedLock lock(imageLock);
+    flushImage();
+    memcpy(sysexBuf, image, SYSEX_PROGRAM_SIZE);
+    return true;
+}
+
+bool IonSysexParams::writeProgramContent(unsigned char *bufPtr, int size)
+{
+    if (size < SYSEX_CONTENT_SIZE) {
+        return false;
+    }
+    const ScopedLock lock(imageLock);
+    flushImage();
+    memcpy(bufPtr, image + 1, SYSEX_CONTENT_SIZE);
+    return true;
+}
+
+// write every field of the program to rawContent (zeroed, 315 bytes)
+void IonSysexParams::encodeContent(unsigned char *rawContent)
+{
+    for(unsigned int i = 0; i < schema.layout.size(); i++){
+        const IonSysexField &f = schema.layout[i];
+		if (f.fxScoped && (shouldSkipFx1(f.nrpn) || shouldSkipFx2(f.nrpn))) {
 			continue;
 		}
-        params[i]->writeValueToBuffer(rawContent);
+        encodeField(f, values[f.paramIndex], rawContent);
     }
 	// if not 1, then we add a new program
 	rawContent[293] = 1;
-     {
-        char str[16];
-        bzero(str, sizeof(str));
-        m_prog_name.copyToUTF8(str, sizeof(str));
-        //	const char *str = CFStringGetCStringPtr(m_textValue, 0);
-        bzero(&rawContent[0], 15);
-        memcpy((char *) &rawContent[0], str, 14);
-        bzero(&rawContent[296], 15);
-        memcpy(&rawContent[296], str, 14);
-    }
-	cs = checksum(rawContent, 315);
-	
-	sysexHeader.hdr[0] = 0xf0 ;
-    sysexHeader.hdr[1] = 0x00;
-    sysexHeader.hdr[2] = 0x00;
-    sysexHeader.hdr[3] = 0x0e;
-    sysexHeader.hdr[4] = 0x22;
-    memcpy(bufPtr, &sysexHeader, sizeof(SysexHeader));
-    bufPtr += sizeof(SysexHeader);
+    memcpy(&rawContent[0], m_prog_name, 14);
+    memcpy(&rawContent[296], m_prog_name, 14);
+}
+
+// contribution of one byte of the program to the (big endian) word sum
+static inline uint32 checksumTerm(int offset, unsigned char value)
+{
+    return (uint32) value << (8 * (3 - (offset & 3)));
+}
+
+void IonSysexParams::rebuildImage()
+{
+    unsigned char *bufPtr = image;
+
+    // the checksum reads whole words, hence the slack at the end of imageRaw
+    memset(imageRaw, 0, sizeof(imageRaw));
+    encodeContent(imageRaw);
+	imageSum = 0 - programChecksum(imageRaw, SYSEX_RAW_SIZE);
+
+    *bufPtr++ = 0xf0;
+    bufPtr[0] = 0x00;
+    bufPtr[1] = 0x00;
+    bufPtr[2] = 0x0e;
+    bufPtr[3] = 0x22;
+    bufPtr += 4;
     
     unsigned int h_opcode = 1;
     unsigned int n_opcode = 1;
@@ -1336,38 +1569,117 @@ bool IonSysexParams::getAsSysexMessage(unsigned char* sysexBuf)
 	intToLeBuff(n_opcode, bufPtr);
     bufPtr += sizeof(unsigned int);
     
-    ProgramHeader programHeader;
     /* TODO: fill program header */
-	bzero(&programHeader, sizeof(programHeader));
-	memcpy(programHeader.tag, "Q01SYNTH", 8);
-	programHeader.n_checksum = htonl(cs);
-	memcpy(programHeader.version, "\x76\x31\x2e\x30\xff\xff\xff\xff", 8);
-	bzero(programHeader.date, 12);
-	bzero(programHeader.time, 12);
-	memcpy(&programHeader.n_length, "\x00\x00\x01\x3b", 4);
-	programHeader.matchId = 0xff;
-	programHeader.dirty = 0;
-	memset(programHeader.padding, 0xff, 6);
-	vector<unsigned char> rawheader;
-	vector<unsigned char> encodedheader;
-	for (unsigned int j = 0; j < 56; j++) {
-		rawheader.push_back(*(((unsigned char *) &programHeader)+ j));
-	}
-	encodeToMidi(rawheader, encodedheader);
-	for (unsigned int j = 0; j < encodedheader.size(); j++) {
-		bufPtr[j] = encodedheader[j];
-	}
+	memset(&imageHeader, 0, sizeof(imageHeader));
+	memcpy(imageHeader.tag, "Q01SYNTH", 8);
+	imageHeader.n_checksum = ByteOrder::swapIfLittleEndian((uint32) (0 - imageSum));
+	memcpy(imageHeader.version, "\x76\x31\x2e\x30\xff\xff\xff\xff", 8);
+	memset(imageHeader.date, 0, 12);
+	memset(imageHeader.time, 0, 12);
+	memcpy(&imageHeader.n_length, "\x00\x00\x01\x3b", 4);
+	imageHeader.matchId = 0xff;
+	imageHeader.dirty = 0;
+	memset(imageHeader.padding, 0xff, 6);
+	midiPack7((unsigned char *) &imageHeader, bufPtr, 56 / 7);
 	
 	bufPtr += sizeof(ProgramHeader);
-    vector <unsigned char> raw;
-    vector <unsigned char> encoded;
-    for(int j = 0; j < 315; j++) raw.push_back(rawContent[j]);
-    encodeToMidi(raw, encoded);
-    for(unsigned int j = 0; j < encoded.size(); j++) bufPtr[j] = encoded[j];
-	
-	sysexBuf[SYSEX_PROGRAM_SIZE - 1] = 0xf7;
-    
-	return true;
+	midiPack7(imageRaw, bufPtr, SYSEX_RAW_SIZE / 7);
+	bufPtr += SYSEX_ENCODED_SIZE;
+	*bufPtr = 0xf7;
+}
+
+// re-pack the midi groups holding the given (ascending) bytes of imageRaw
+void IonSysexParams::patchImageBytes(const short *bytes, int n)
+{
+    unsigned char *body = image + 1 + 4 + sizeof(unsigned int) + sizeof(ProgramHeader);
+    int last = -1;
+    for (int i = 0; i < n; i++) {
+        int group = bytes[i] / 7;
+        if (group != last) {
+            midiPack7(imageRaw + 7 * group, body + 8 * group, 1);
+            last = group;
+        }
+    }
+}
+
+// bring the image up to date with the parameters. caller holds imageLock.
+void IonSysexParams::flushImage()
+{
+    bool stale, name;
+    {
+        SpinLock::ScopedLockType lock(dirtyLock);
+        stale = imageStale;
+        name = nameDirty;
+        imageStale = nameDirty = false;
+        for (unsigned int w = 0; w < dirtyParams.size(); w++) {
+            pendingParams[w] = dirtyParams[w];
+            dirtyParams[w] = 0;
+        }
+    }
+    if (stale) {
+        rebuildImage();
+        return;
+    }
+
+    uint32 oldSum = imageSum;
+    if (++imageStamp == 0) {
+        byteGroupStamp.assign(byteGroupStamp.size(), 0);
+        imageStamp = 1;
+    }
+    for (unsigned int w = 0; w < pendingParams.size(); w++) {
+        for (uint64 bits = pendingParams[w]; bits != 0; bits &= bits - 1) {
+            int idx = w * 64;
+            for (uint64 low = bits & (0 - bits); low >>= 1; ) idx++;
+            int field = schema.fieldOfParam[idx];
+            if (field < 0) {
+                continue;
+            }
+            int g = schema.byteGroupOfField[field];
+            if (byteGroupStamp[g] == imageStamp) {
+                continue;
+            }
+            byteGroupStamp[g] = imageStamp;
+
+            const IonSysexSchema::ByteGroup &group = schema.byteGroups[g];
+            for (unsigned int i = 0; i < group.bytes.size(); i++) {
+                imageSum -= checksumTerm(group.bytes[i], imageRaw[group.bytes[i]]);
+                imageRaw[group.bytes[i]] = 0;
+            }
+            for (unsigned int i = 0; i < group.fields.size(); i++) {
+                const IonSysexField &f = schema.layout[group.fields[i]];
+                if (f.fxScoped && (shouldSkipFx1(f.nrpn) || shouldSkipFx2(f.nrpn))) {
+                    continue;
+                }
+                encodeField(f, values[f.paramIndex], imageRaw);
+            }
+            for (unsigned int i = 0; i < group.bytes.size(); i++) {
+                int b = group.bytes[i];
+                if (b == 293) {
+                    imageRaw[b] = 1;
+                } else if (b < 14) {
+                    imageRaw[b] = m_prog_name[b];
+                } else if (b >= 296 && b < 296 + 14) {
+                    imageRaw[b] = m_prog_name[b - 296];
+                }
+                imageSum += checksumTerm(b, imageRaw[b]);
+            }
+            patchImageBytes(&group.bytes[0], group.bytes.size());
+        }
+    }
+    if (name) {
+        static const short nameBytes[] = { 0, 13, 296, 303, 309 };
+        for (int i = 0; i < 14; i++) {
+            imageSum -= checksumTerm(i, imageRaw[i]) + checksumTerm(296 + i, imageRaw[296 + i]);
+            imageRaw[i] = imageRaw[296 + i] = m_prog_name[i];
+            imageSum += checksumTerm(i, imageRaw[i]) + checksumTerm(296 + i, imageRaw[296 + i]);
+        }
+        patchImageBytes(nameBytes, 5);
+    }
+    if (imageSum != oldSum) {
+        // the checksum sits in the second group of the packed header
+        imageHeader.n_checksum = ByteOrder::swapIfLittleEndian((uint32) (0 - imageSum));
+        midiPack7((unsigned char *) &imageHeader + 7, image + 1 + 4 + sizeof(unsigned int) + 8, 1);
+    }
 }
 
 ////////// IonSysex
@@ -1380,7 +1692,7 @@ IonSysex::IonSysex()
    strerror = "";
 }
 
-IonSysex::IonSysex(unsigned char* buf, UInt32 len)
+IonSysex::IonSysex(unsigned char* buf, uint32 len)
 {
    hasErrors = false;
    if(len != SYSEX_PROGRAM_SIZE){
@@ -1544,14 +1856,71 @@ bool IonSysexTests()
         logDebug("a and c not same size\n");
         return false;
     }
-    for(int i = 0; i < a.size(); i++) if(a[i] != c[i]) {
+    for(size_t i = 0; i < a.size(); i++) if(a[i] != c[i]) {
 		logDebug("Mismatching element");
         return false;
     }
-    // test headers
-    // test contents
-    // test name
-    IonSysex is("test.syx");
+    // the word kernels must agree with the reference versions above
+    logDebug("Testing word pack and unpack against reference: ");
+    Random rnd(1);
+    for (int groups = 0; groups <= 45; groups++) {
+        vector <unsigned char> raw, ref, refRaw;
+        unsigned char packed[360], unpacked[360];
+        for (int i = 0; i < groups * 7; i++) raw.push_back((unsigned char) rnd.nextInt(256));
+        encodeToMidi(raw, ref);
+        decodeFromMidi(ref, refRaw);
+        midiPack7(raw.size() ? &raw[0] : packed, packed, groups);
+        if (memcmp(packed, ref.size() ? &ref[0] : packed, ref.size()) != 0) {
+            logDebug("midiPack7 mismatch");
+            return false;
+        }
+        midiUnpack7(packed, unpacked, groups);
+        if (memcmp(unpacked, refRaw.size() ? &refRaw[0] : unpacked, refRaw.size()) != 0) {
+            logDebug("midiUnpack7 mismatch");
+            return false;
+        }
+        // in place
+        midiUnpack7(packed, packed, groups);
+        if (memcmp(packed, unpacked, groups * 7) != 0) {
+            logDebug("in place midiUnpack7 mismatch");
+            return false;
+        }
+    }
+    // whatever we write has to check out, and once decoded (not every value of every
+    // parameter can be stored) write and decode again to the same bytes
+    logDebug("Testing program round trip: ");
+    IonSysexParams params;
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        IonSysexParam *p = params.getParam(i);
+        if ((p->getConversionType() != IonSysexParam::NAME) && (p->getConversionType() != IonSysexParam::TEXT_LABEL)) {
+            p->setValue(p->getMin() + rnd.nextInt(p->getMax() - p->getMin() + 1));
+        }
+    }
+    params.set_prog_name("round trip");
+    unsigned char first[SYSEX_PROGRAM_SIZE], second[SYSEX_PROGRAM_SIZE], third[SYSEX_PROGRAM_SIZE];
+    vector<int16> values(params.numParams());
+    char name[15];
+    params.writeProgram(first, sizeof(first));
+    if (IonSysexSchema::get().decodeProgram(first, sizeof(first), &values[0], name) != PROGRAM_OK) {
+        logDebug("written program doesn't check out");
+        return false;
+    }
+    IonSysexParams copy, again;
+    copy.readProgramContent(first + 1, SYSEX_CONTENT_SIZE);
+    copy.writeProgram(second, sizeof(second));
+    again.readProgramContent(second + 1, SYSEX_CONTENT_SIZE);
+    again.writeProgram(third, sizeof(third));
+    if ((memcmp(second, third, sizeof(second)) != 0) || (strcmp(name, "round trip") != 0)) {
+        logDebug("program round trip mismatch");
+        return false;
+    }
+    // 13 ascii bytes and a two byte character don't fit in 14 bytes
+    logDebug("Testing long program names: ");
+    params.set_prog_name(String("abcdefghijklm") + String::charToString((juce_wchar) 0xe9));
+    if (strcmp(params.get_prog_name().toRawUTF8(), "abcdefghijklm") != 0) {
+        logDebug("program name cut inside a character");
+        return false;
+    }
     return true;
 }
 
@@ -1669,18 +2038,18 @@ bool IonSysex::WriteXMLDefinition()
     return true;
 }
 
-UInt32 toBigEndian(unsigned char *b)
+uint32 toBigEndian(const unsigned char *b)
 {
   return (*b << 24) | (*(b+1) << 16) | (*(b+2) << 8) | *(b+3);
 }
 
-static UInt32 checksum(unsigned char *buff, UInt32 len)
+uint32 programChecksum(const unsigned char *buff, uint32 len)
 {
-	UInt32 cs = 0;
-	UInt32 i;
+	uint32 cs = 0;
+	uint32 i;
 	
 	for (i = 0; i < len; i += 4) {
-		UInt32 oldcs = cs;
+		uint32 oldcs = cs;
 		cs += toBigEndian(&buff[i]);
 		if (cs < oldcs) {
 		}
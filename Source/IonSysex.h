@@ -27,8 +27,13 @@
 #include <vector>
 #include <map>
 #include <iostream>
-#include <MacTypes.h>
-#include "../JuceLibraryCode/JuceHeader.h"
+
+// only juce_core, so that the codec also builds headless without the plugin modules
+#include "../JuceLibraryCode/AppConfig.h"
+#include "../JuceLibraryCode/modules/juce_core/juce_core.h"
+#if ! DONT_SET_USING_JUCE_NAMESPACE
+using namespace juce;
+#endif
 
 #define FX1_SELECTOR 800
 #define FX2_SELECTOR 801
@@ -37,8 +42,11 @@
 #define FX2_FIRST_NRPN 920
 #define FX2_LAST_NRPN FX2_FIRST_NRPN+5*6
 #define NO_NRPN 4096
-//typedef unsigned int UInt32;
-//typedef int SInt32;
+
+#define SYSEX_PROGRAM_SIZE 434  // a whole program dump, f0 .. f7
+#define SYSEX_CONTENT_SIZE 432  // everything between the f0 and the f7
+#define SYSEX_ENCODED_SIZE 360  // midi encoded program content
+#define SYSEX_RAW_SIZE 315      // decoded program content
 
 // TODO: remove this "using namespace" from here
 using namespace std;
@@ -68,15 +76,47 @@ typedef struct _ProgramHeader ProgramHeader;
 
 class IonSysex;
 class IonSysexParams;
+class IonSysexParam;
+
+// precompiled description of how one parameter is packed into the decoded program.
+// built once per parameter from parameters.xml, see IonSysexSchema::describeField()
+struct IonSysexField {
+   enum Special {
+      PLAIN = 0,
+      FM_ALGORITHM,
+      OSC_SYNC,
+      PORTAMENTO,
+      UNISON,
+      FX_MIX
+   };
+   short paramIndex;          // into the schema and the value store
+   short nrpn;
+   short byteOffset;          // byte holding the low bits
+   short hiByteOffset;        // byte holding the high 8 bits of 16 bit fields, -1 otherwise
+   unsigned char shift;
+   bool partial;              // field only owns mask << shift of its byte
+   unsigned short mask;
+   int signBit;               // 0 for unsigned fields
+   short bias;
+   short readMin, readMax;
+   short writeMin, writeMax;
+   short cntrlOffset;
+   unsigned char special;
+   bool fxScoped;             // only written when its fx is the selected one
+   const int *decodeMap;      // sysex -> nrpn value remap table, or NULL
+   const int *encodeMap;      // nrpn -> sysex value remap table, or NULL
+};
 
 class ListItemParameter{
     public:
         ListItemParameter(const char *name);
-        const char *getName();
-        bool isDisabled();
+        constexpr ListItemParameter(const char *name, bool enabled, bool hasSpecialNrpnValue, int nrpnValue) :
+            m_name(name), m_enabled(enabled), m_hasSpecialNrpnValue(hasSpecialNrpnValue), m_nrpnValue(nrpnValue) {}
+        const char *getName() const;
+        bool isDisabled() const;
         void setEnabled(bool enabled);
-        bool hasSpecialNrpnValue();
-        int  getNrpnValue();
+        bool hasSpecialNrpnValue() const;
+        int  getNrpnValue() const;
         void setSpecialNrpnValue(int nrpn);
     private:
         const char *m_name;
@@ -85,10 +125,12 @@ class ListItemParameter{
         int m_nrpnValue;
 };
 
+struct IonSysexParamDesc;
+
+// a parameter of one IonSysexParams. the description comes from the shared
+// IonSysexSchema, the value lives in the owner's value store.
 class IonSysexParam {
    public:
-      IonSysexParam(const char *name);
-
       enum Conversion{
          NONE = 0,
          LIST,
@@ -118,30 +160,32 @@ class IonSysexParam {
 		 MS,
 		 OCTAVE,
 		 SEMITONE,
-         BANK
+         BANK,
+         NUM_CONVERSIONS
       };
 
-      const char *getName() { return m_name; }
+      const char *getName();
       Conversion getConversionType();
-      vector<ListItemParameter> &getList();
+      const vector<ListItemParameter> &getList();
       int getBitWidth();
       int getValue();
       void setValue(int value);
       int getNrpnValue();
-	  int getDefaultValue() { return m_defaultValue;}
- 	  void setDefaultValue(int v) { m_defaultValue = v;}
-      String getConvertedValue(SInt32 val);
+	  int getDefaultValue();
+      String getConvertedValue(int32 val);
+      // display text of any value of the parameter, and back. the strings are shared
+      // and preformatted, String::empty for values out of range.
+      const String &getValueText(int value);
+      bool getValueFromText(const String &text, int &value);
       String getTextValue();
 	  bool setTextValue(const char *);
-      void setParamName(const char *);
 	  String getParamName();
-	  bool setValueFromContent(unsigned char *content);
-      bool writeValueToBuffer(unsigned char *buffer);
       bool writeNameToBuffer(unsigned char *buffer);
       void printDebug();
 
-      int getMin() { return m_min - m_cntrlOffset; };
-      int getMax() { return m_max - m_cntrlOffset; };
+      int getMin();
+      int getMax();
+      int getIndex() const { return m_index; }
       int getNrpn() const;
 	  int getCntrlOffset();
 	  bool hasNrpn();
@@ -151,40 +195,117 @@ class IonSysexParam {
 	  bool isMatrixDest() const;
 	  bool isModLevel() const;
 	  bool isModOffset() const;
-	  SInt32 fxSelectorToNrpn();
-	  SInt32 fxMin();
-	  SInt32 fxMax();
+	  int32 fxSelectorToNrpn();
+	  int32 fxMin();
+	  int32 fxMax();
    
       friend class IonSysexParams;
+      friend class IonSysexSchema;
       friend class IonSysex;
       
 
    private:
-      bool setNameFromContent(unsigned char *content);
-	  unsigned char progName[16];
-     // bool setList(string list);
-      void appendToList(ListItemParameter value);
-      void setNrpn(int nrpn);
-      bool setConversion(Conversion conv);
-      bool setMin(int min);
-      bool setMax(int max);
-      bool setOffset(int offset);
-	  void setCntrlOffset(int cntrloffset);
-      int m_offset;
-      vector<ListItemParameter> m_list;
-      bool m_hasMin;
-      bool m_hasMax;
-      bool m_valueSet;
-      int m_value;
-      const char *m_name;
-      String m_textValue;
-	  const char *m_paramName;
-      int m_min;
-      int m_max;
-      int m_nrpn;
-	  int m_cntrlOffset;
-	  int m_defaultValue;
-      Conversion m_conv;
+      IonSysexParam(IonSysexParams *owner, int index);
+      static void formatValue(Conversion conv, int val, char *buf);
+      const IonSysexParamDesc *m_desc;
+      IonSysexParams *m_owner;
+      int m_index;               // into the schema and the owner's value store
+};
+
+// one parameter of parameters.xml, as compiled into params_table.h by gen_params.py
+struct IonSysexParamDesc {
+   const char *name;
+   const char *paramName;
+   IonSysexParam::Conversion conv;
+   int min;
+   int max;
+   int offset;
+   int nrpn;
+   int defaultValue;
+   int cntrlOffset;
+   int firstListItem;
+   int numListItems;
+};
+
+// what decodeProgram() thinks of a sysex message
+enum ProgramStatus {
+   PROGRAM_OK = 0,
+   PROGRAM_BAD_SIZE,       // not a whole f0 .. f7 message of SYSEX_PROGRAM_SIZE bytes
+   PROGRAM_NOT_PROGRAM,    // some other sysex message
+   PROGRAM_BAD_CHECKSUM
+};
+
+// everything about the parameters that is the same for every plugin instance. built
+// once per process from params_table.h and shared by all IonSysexParams.
+class IonSysexSchema {
+   public:
+      static const IonSysexSchema &get();
+
+      int numParams() const { return count; }
+      const IonSysexParamDesc &getDesc(int idx) const;
+      const vector<ListItemParameter> &getList(int idx) const { return lists[idx]; }
+
+      // parameter indexes, -1 if there is no such parameter
+      int indexOfNrpn(int nrpn) const;
+      int indexOfOffset(int sysexoffset) const;   // first parameter stored at this offset
+      int nextAtOffset(int idx) const;            // next parameter sharing idx's offset
+      int indexOfName(const String &name) const;  // by paramname, then name
+
+      // preformatted display text of a parameter value, NULL if out of range
+      const String *findValueText(int idx, int value) const;
+      bool findTextValue(int idx, const String &text, int &value) const;
+
+      // decode a program straight into numParams() values and the name (15 bytes, nul
+      // terminated), without an IonSysexParams. safe to call from any thread.
+      ProgramStatus decodeProgram(const unsigned char *program, int size, int16 *values, char *name) const;
+      // the SYSEX_ENCODED_SIZE bytes of midi encoded content, the checksum isn't looked at
+      void decodeContent(const unsigned char *encoded, int16 *values, char *name) const;
+
+      // hash of what a program sounds like: the values of every stored parameter but the
+      // name, so copies that only differ in name, header date and time or checksum padding
+      // hash the same
+      uint64 canonicalHash(const int16 *values) const;
+
+      // how the parameters are stored in the decoded program
+      vector<IonSysexField> layout;
+      vector<short> fieldOfParam;      // index into layout, -1 if not stored in the program
+
+      // fields sharing a byte of the program have to be re-encoded together, in
+      // parameter order. each field belongs to one such group.
+      struct ByteGroup {
+          vector<int> fields;
+          vector<short> bytes;
+      };
+      vector<ByteGroup> byteGroups;
+      vector<int> byteGroupOfField;
+
+   private:
+      IonSysexSchema();
+      ~IonSysexSchema();
+      bool describeField(int idx, IonSysexField &f) const;
+      void decodeRaw(const unsigned char *decodedContent, int16 *values, char *name) const;
+      int count;
+      vector< vector<ListItemParameter> > lists;
+      vector<short> byNrpn;
+      vector<short> byOffset;
+      vector<short> sameOffset;
+      vector<short> hashedParams;
+      HashMap<String, int> byName;
+
+      // display strings, built on first use: one table per list parameter and one
+      // per conversion covering the range of all the parameters using it
+      struct ValueTextTable {
+          int first;                  // val of texts[0]
+          vector<String> texts;
+          HashMap<String, int> values;
+      };
+      const ValueTextTable *getTextTable(int idx) const;
+      int convMin[IonSysexParam::NUM_CONVERSIONS];
+      int convMax[IonSysexParam::NUM_CONVERSIONS];
+      mutable ValueTextTable *textOfConv[IonSysexParam::NUM_CONVERSIONS];
+      mutable vector< Atomic<ValueTextTable*> > textOfParam;
+      mutable OwnedArray<ValueTextTable> textTables;
+      mutable CriticalSection textLock;
 };
 
 /* The content goes from 
@@ -193,33 +314,83 @@ class IonSysexParam {
        0x1b1  (434)      -> F7 (sysex footer)
        */
 
-// parameter descriptions loaded from XML
+// the values of one program, described by the IonSysexSchema
 class IonSysexParams{
    public:
       IonSysexParams();
       bool parseParamsFromContent(unsigned char *content, int contentSize);
       void fillBuffer(unsigned char *buffer);
-	  IonSysexParam *getParam(UInt32 idx);
-	  UInt32 numParams() {return params.size();}
+	  IonSysexParam *getParam(uint32 idx);
+	  uint32 numParams() {return params.size();}
+      IonSysexParam *getParamByNrpn(int nrpn);           // NULL if none
+      IonSysexParam *getParamByName(const String &name); // NULL if none
       ~IonSysexParams();
       bool getAsSysexMessage(unsigned char *sysBuf);
+
+      // allocation free program io. content is the SYSEX_CONTENT_SIZE bytes between the
+      // f0 and f7 of a program dump, a program is the whole SYSEX_PROGRAM_SIZE byte dump.
+      // sizes are those of the caller's buffers.
+      bool readProgramContent(const unsigned char *content, int size);
+      bool writeProgramContent(unsigned char *content, int size);
+      bool writeProgram(unsigned char *program, int size);
     
-      String get_prog_name() {return m_prog_name;}
-      void set_prog_name(String s) {m_prog_name = s;}
+      String get_prog_name();
+      void set_prog_name(String s);
+      uint64 canonicalHash() const { return schema.canonicalHash(&values[0]); }
 
       // returns adjusted nrpn number if this is an fx parameter, otherwise returns normal nrpn
-      SInt32 fx1fx2NrpnNum(IonSysexParam *p);
-      bool shouldSkipFx1(IonSysexParam *p);
-      bool shouldSkipFx2(IonSysexParam *p);
+      int32 fx1fx2NrpnNum(IonSysexParam *p);
+      bool shouldSkipFx1(IonSysexParam *p) { return shouldSkipFx1(p->getNrpn()); }
+      bool shouldSkipFx2(IonSysexParam *p) { return shouldSkipFx2(p->getNrpn()); }
+      bool shouldSkipFx1(int nrpn);
+      bool shouldSkipFx2(int nrpn);
+
+      // nrpn to send on the wire for a parameter with the current fx selection, with the
+      // 512 offset already removed, or NO_NRPN if it must not be sent. the table behind it
+      // is only rebuilt after an fx selector or a whole program changes.
+      int wireNrpn(int idx) { if (routingStale.get()) rebuildRouting(); return routing[routingActive.get()][idx]; }
+
+      // called by IonSysexParam::setValue
+      void paramChanged(int idx);
+
+      friend class IonSysexParam;
 
     private:
       SysexHeader sysexHeader;
       ProgramHeader programHeader;
-      void initFromXml();
-      vector<IonSysexParam*> params;
+      void encodeContent(unsigned char *rawContent);
+      void rebuildImage();
+      void flushImage();
+      void patchImageBytes(const short *bytes, int n);
+      void rebuildRouting();
+      const IonSysexSchema &schema;
+      vector<IonSysexParam> params;
+      vector<int16> values;        // one per parameter, in schema order
 	  IonSysexParam *fx1Param;
 	  IonSysexParam *fx2Param;
-      String m_prog_name;
+      char m_prog_name[15];
+      // wireNrpn per parameter. rebuilt into the table not in use and swapped in, so a
+      // reader never sees a table half written
+      vector<short> routing[2];
+      Atomic<int> routingActive;
+      Atomic<int> routingStale;
+      SpinLock routingLock;         // one rebuild at a time
+
+      // the current program, kept encoded and ready to send. parameter changes only mark
+      // their parameter dirty; the next export re-encodes just those fields, the midi groups
+      // they live in and the checksum.
+      unsigned char image[SYSEX_PROGRAM_SIZE];
+      unsigned char imageRaw[SYSEX_RAW_SIZE + 5];
+      ProgramHeader imageHeader;
+      uint32 imageSum;
+      bool imageStale;
+      bool nameDirty;
+      vector<uint64> dirtyParams;
+      vector<uint64> pendingParams;
+      SpinLock dirtyLock;
+      CriticalSection imageLock;
+      vector<uint32> byteGroupStamp;   // avoids patching a group twice in one flush
+      uint32 imageStamp;
 };
 
 // parameters loaded from sysex
@@ -227,7 +398,7 @@ class IonSysex{
    public:
       IonSysex();
       IonSysex(string fileName);
-	  IonSysex(unsigned char* buf, UInt32 len);
+	  IonSysex(unsigned char* buf, uint32 len);
       bool Save();
       bool SaveAs();
       bool Print();
@@ -249,6 +420,27 @@ class IonSysex{
       int fileSize;
 };
 
+// 7 bit midi packing used for the program header and content: every group of 7 raw
+// bytes travels as 8 midi bytes, the first one holding the high bits of the other 7.
+// midiUnpack7 may be called with encoded == raw.
+void midiPack7(const unsigned char *raw, unsigned char *encoded, int groups);
+void midiUnpack7(const unsigned char *encoded, unsigned char *raw, int groups);
+
+// a program name as decoded, nul terminated within maxBytes or not. names that aren't
+// valid utf-8 are taken a byte at a time, so a broken name never reads past its bytes.
+String programNameToString(const char *name, int maxBytes);
+
+// negated sum of the big endian words of the decoded content, as stored in the program
+// header. reads whole words, so len is rounded up to a multiple of 4.
+uint32 programChecksum(const unsigned char *buff, uint32 len);
+
+// checks the size, framing and header of a program dump, but not its checksum
+ProgramStatus checkProgramHeader(const unsigned char *program, int size);
+
+// fixes the checksum in the header of a program dump in place, nothing else is touched.
+// returns what the dump was like before, so PROGRAM_BAD_CHECKSUM means it got fixed.
+ProgramStatus rechecksumProgram(unsigned char *program, int size);
+
 bool IonSysexTests();
 
 #endif
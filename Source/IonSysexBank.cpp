@@ -0,0 +1,190 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "IonSysexBank.h"
+
+// fewer programs than this aren't worth waking up another thread for
+#define MIN_PROGRAMS_PER_JOB 32
+
+#define NAME_SIZE 15
+
+class IonSysexBank::DecodeJob : public ThreadPoolJob
+{
+public:
+    DecodeJob(IonSysexBank &b, const unsigned char *d, int f, int l) :
+        ThreadPoolJob("sysex decode"), bank(b), data(d), first(f), last(l) {
+    }
+    JobStatus runJob() {
+        bank.decodeRange(data, first, last);
+        return jobHasFinished;
+    }
+private:
+    IonSysexBank &bank;
+    const unsigned char *data;
+    int first, last;
+};
+
+IonSysexBank::IonSysexBank() :
+    schema(IonSysexSchema::get())
+{
+    programs = 0;
+    errors = 0;
+    poolThreads = 0;
+
+    // parameters that aren't stored in a program keep their minimum, as in a fresh IonSysexParams
+    for (int i = 0; i < schema.numParams(); i++) {
+        blank.push_back((int16) schema.getDesc(i).min);
+    }
+}
+
+IonSysexBank::~IonSysexBank()
+{
+}
+
+void IonSysexBank::clear()
+{
+    messages.clearQuick();
+    messageOfProgram.clear();
+    values.clear();
+    names.clear();
+    hashes.clear();
+    programs = 0;
+    errors = 0;
+}
+
+int IonSysexBank::loadFile(const File &file, int numThreads)
+{
+    MemoryBlock data;
+    if (!file.loadFileAsData(data)) {
+        clear();
+        return 0;
+    }
+    return parse(data.getData(), data.getSize(), numThreads);
+}
+
+int IonSysexBank::parse(const void *data, size_t size, int numThreads)
+{
+    const unsigned char *stream = (const unsigned char *) data;
+    const unsigned char *end = stream + size;
+    const unsigned char *p = stream;
+
+    clear();
+
+    // split on f0/f7. only cheap framing and header checks here, the checksums are
+    // done by the workers while they decode.
+    while ((p < end) && ((p = (const unsigned char *) memchr(p, 0xf0, end - p)) != NULL)) {
+        const unsigned char *f7 = (const unsigned char *) memchr(p + 1, 0xf7, end - p - 1);
+        const unsigned char *stop = (f7 != NULL) ? f7 : end;
+        const unsigned char *next = (const unsigned char *) memchr(p + 1, 0xf0, stop - p - 1);
+
+        Message m;
+        m.offset = p - stream;
+        m.program = -1;
+        if (next != NULL) {
+            // cut off by the start of the next message
+            m.size = (int) (next - p);
+            m.status = PROGRAM_BAD_SIZE;
+            p = next;
+        } else if (f7 == NULL) {
+            m.size = (int) (end - p);
+            m.status = PROGRAM_BAD_SIZE;
+            p = end;
+        } else {
+            m.size = (int) (f7 + 1 - p);
+            m.status = checkProgramHeader(p, m.size);
+            p = f7 + 1;
+        }
+        if (m.status == PROGRAM_OK) {
+            messageOfProgram.push_back(messages.size());
+        } else if (m.status == PROGRAM_BAD_SIZE) {
+            errors++;
+        }
+        messages.add(m);
+    }
+
+    int n = (int) messageOfProgram.size();
+    if (n == 0) {
+        return 0;
+    }
+    values.resize((size_t) n * schema.numParams());
+    names.resize((size_t) n * NAME_SIZE);
+    hashes.resize(n);
+
+    // the programs all take the same time, so give every thread an equal share and
+    // do the first one on this thread
+    if (numThreads <= 0) {
+        numThreads = SystemStats::getNumCpus();
+    }
+    int jobs = jmax(1, jmin(numThreads, n / MIN_PROGRAMS_PER_JOB));
+    if (jobs == 1) {
+        decodeRange(stream, 0, n);
+    } else {
+        if ((pool == nullptr) || (poolThreads != jobs - 1)) {
+            pool = new ThreadPool(jobs - 1);
+            poolThreads = jobs - 1;
+        }
+        OwnedArray<DecodeJob> running;
+        for (int i = 1; i < jobs; i++) {
+            running.add(new DecodeJob(*this, stream, (int) ((int64) n * i / jobs), (int) ((int64) n * (i + 1) / jobs)));
+            pool->addJob(running.getLast(), false);
+        }
+        decodeRange(stream, 0, n / jobs);
+        for (int i = 0; i < running.size(); i++) {
+            pool->waitForJobToFinish(running[i], -1);
+        }
+    }
+
+    // squeeze out the programs that failed their checksum
+    int stride = schema.numParams();
+    for (int i = 0; i < n; i++) {
+        Message &m = messages.getReference(messageOfProgram[i]);
+        if (m.status != PROGRAM_OK) {
+            errors++;
+            continue;
+        }
+        if (programs != i) {
+            memcpy(&values[(size_t) programs * stride], &values[(size_t) i * stride], stride * sizeof(int16));
+            memcpy(&names[(size_t) programs * NAME_SIZE], &names[(size_t) i * NAME_SIZE], NAME_SIZE);
+            hashes[programs] = hashes[i];
+            messageOfProgram[programs] = messageOfProgram[i];
+        }
+        m.program = programs++;
+    }
+    messageOfProgram.resize(programs);
+    values.resize((size_t) programs * stride);
+    names.resize((size_t) programs * NAME_SIZE);
+    hashes.resize(programs);
+    return programs;
+}
+
+// runs on the worker threads, every program has its own message and rows
+void IonSysexBank::decodeRange(const unsigned char *data, int first, int last)
+{
+    int stride = schema.numParams();
+    for (int i = first; i < last; i++) {
+        Message &m = messages.getReference(messageOfProgram[i]);
+        int16 *row = &values[(size_t) i * stride];
+        memcpy(row, &blank[0], stride * sizeof(int16));
+        m.status = schema.decodeProgram(data + m.offset, m.size, row, &names[(size_t) i * NAME_SIZE]);
+        if (m.status == PROGRAM_OK) {
+            hashes[i] = schema.canonicalHash(row);
+        }
+    }
+}
+
+const int16 *IonSysexBank::getValues(int program) const
+{
+    return &values[(size_t) program * schema.numParams()];
+}
+
+String IonSysexBank::getName(int program) const
+{
+    const char *name = &names[(size_t) program * NAME_SIZE];
+    return programNameToString(name, NAME_SIZE);
+}
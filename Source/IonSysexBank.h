@@ -0,0 +1,64 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _IONSYSEXBANK_H_
+#define _IONSYSEXBANK_H_
+
+#include "IonSysex.h"
+
+// any number of concatenated sysex messages, e.g. a .syx file holding a whole hardware
+// backup. parse() splits the stream on f0/f7, checks every message and decodes the
+// program dumps into their values and canonical hashes, spread over a pool of worker
+// threads.
+class IonSysexBank {
+   public:
+      struct Message {
+         int64 offset;            // of the f0 in the stream
+         int size;                // f0 .. f7, or up to where the message was cut off
+         ProgramStatus status;
+         int program;             // index of the decoded program, -1 if not a good one
+      };
+
+      IonSysexBank();
+      ~IonSysexBank();
+
+      // numThreads <= 0 uses one thread per cpu. returns the number of good programs.
+      int parse(const void *data, size_t size, int numThreads = 0);
+      int loadFile(const File &file, int numThreads = 0);
+      void clear();
+
+      int numMessages() const { return messages.size(); }
+      const Message &getMessage(int idx) const { return messages.getReference(idx); }
+      int numErrors() const { return errors; }   // cut off messages and bad checksums
+
+      int numPrograms() const { return programs; }
+      const int16 *getValues(int program) const;   // IonSysexSchema::numParams() values
+      String getName(int program) const;
+      uint64 getHash(int program) const { return hashes[program]; }   // IonSysexSchema::canonicalHash()
+
+   private:
+      class DecodeJob;
+      void decodeRange(const unsigned char *data, int first, int last);
+
+      const IonSysexSchema &schema;
+      Array<Message> messages;
+      vector<int> messageOfProgram;
+      vector<int16> values;        // a row of numParams() per program
+      vector<int16> blank;         // what a row starts as
+      vector<char> names;          // a row of 15 per program
+      vector<uint64> hashes;
+      int programs;
+      int errors;
+      ScopedPointer<ThreadPool> pool;
+      int poolThreads;
+
+      JUCE_DECLARE_NON_COPYABLE (IonSysexBank)
+};
+
+#endif
@@ -0,0 +1,601 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "LibraryIndex.h"
+#include "PatchQuery.h"
+#include <algorithm>
+
+// above this many libraries all but the biggest are merged, so that a watcher updating
+// one file at a time doesn't leave a mapping per file
+#define MAX_SEGMENTS 16
+
+// the patch numbers a restored state can ask for, anything above is taken as garbage
+#define MAX_NUMBERS (1 << 22)
+
+// the programs of one update, as a temporary library. gone with the last file using it.
+struct LibraryIndex::Segment : public ReferenceCountedObject {
+    typedef ReferenceCountedObjectPtr<Segment> Ptr;
+
+    Segment() : temp(".mnlib") {}
+    bool write(const PatchLibrary::Builder &builder) {
+        return builder.write(temp.getFile()) && library.open(temp.getFile());
+    }
+
+    TemporaryFile temp;        // goes after the mapping of it
+    PatchLibrary library;
+    ScopedPointer<PatchQuery> query;   // the last one run on it, for select()
+    CriticalSection queryLock;
+};
+
+struct LibraryIndex::FileEntry {
+    File file;
+    String path;
+    Time modified;
+    int64 size;
+    Segment::Ptr segment;            // nullptr if the file has no programs
+    int first;                       // of its programs in the segment
+    vector<int64> offsets;           // of each program in the file
+    vector<int> *numbers;            // in LibraryIndex::numbers
+};
+
+LibraryIndex::LibraryIndex() :
+    schema(IonSysexSchema::get()),
+    categoryParam(IonSysexSchema::get().indexOfNrpn(666))
+{
+}
+
+LibraryIndex::~LibraryIndex()
+{
+}
+
+void LibraryIndex::addListener(Listener *listener)
+{
+    const ScopedLock sl(listenerLock);
+    listeners.addIfNotAlreadyThere(listener);
+}
+
+void LibraryIndex::removeListener(Listener *listener)
+{
+    const ScopedLock sl(listenerLock);
+    listeners.removeFirstMatchingValue(listener);
+}
+
+void LibraryIndex::changed()
+{
+    version += 1;
+    const ScopedLock sl(listenerLock);
+    for (int i = 0; i < listeners.size(); i++) {
+        listeners[i]->libraryChanged(*this);
+    }
+}
+
+// index of the entry for path, or -(where it would go) - 1
+int LibraryIndex::findFile(const String &path) const
+{
+    int lo = 0, hi = entries.size();
+    while (lo < hi) {
+        int mid = (lo + hi) / 2;
+        int c = entries[mid]->path.compare(path);
+        if (c == 0) {
+            return mid;
+        }
+        if (c < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    return -lo - 1;
+}
+
+// locked by the caller
+void LibraryIndex::counted()
+{
+    int n = 0;
+    for (int i = 0; i < entries.size(); i++) {
+        n += (int) entries[i]->offsets.size();
+    }
+    patchCount = n;
+    numberCount = (int) patches.size();
+}
+
+// puts e in place of the entry for its path, its programs get the numbers they had,
+// the ones it didn't have before new ones. locked by the caller.
+void LibraryIndex::place(FileEntry *e)
+{
+    int at = findFile(e->path);
+    if (at >= 0) {
+        drop(at);
+    } else {
+        at = -at - 1;
+    }
+    entries.insert(at, e);
+    e->numbers = &numbers[e->path];
+    vector<int> &n = *e->numbers;
+    for (int p = 0; p < (int) e->offsets.size(); p++) {
+        if (p == (int) n.size()) {
+            n.push_back((int) patches.size());
+            patches.push_back(Location());
+        }
+        patches[n[p]].entry = e;
+        patches[n[p]].program = p;
+    }
+}
+
+// removes an entry, its numbers become gaps. locked by the caller.
+void LibraryIndex::drop(int at)
+{
+    const FileEntry *e = entries[at];
+    for (size_t p = 0; p < e->offsets.size(); p++) {
+        patches[(*e->numbers)[p]].entry = nullptr;
+    }
+    entries.remove(at);
+}
+
+namespace {
+    // the order of the entries
+    struct ByPath {
+        static int compareElements(const File &a, const File &b) {
+            return a.getFullPathName().compare(b.getFullPathName());
+        }
+    };
+}
+
+void LibraryIndex::update(const Array<File> &files, int numThreads)
+{
+    if (files.size() == 0) {
+        return;
+    }
+
+    // decoding and writing out happens without the lock, readers only wait for the swap.
+    // the files are taken in path order, so that the programs of a new directory are
+    // numbered that way.
+    Array<File> sorted(files);
+    ByPath byPath;
+    sorted.sort(byPath);
+    SyxScanner scanner;
+    scanner.scanFiles(sorted, numThreads);
+    OwnedArray<FileEntry> decoded;
+    for (int i = 0; i < sorted.size(); i++) {
+        FileEntry *e = decoded.add(new FileEntry());
+        e->file = sorted[i];
+        e->path = sorted[i].getFullPathName();
+        e->modified = sorted[i].getLastModificationTime();
+        e->size = sorted[i].getSize();
+        e->first = 0;
+    }
+    PatchLibrary::Builder builder;
+    ScopedPointer<MemoryMappedFile> map;
+    int mapped = -1;
+    for (int p = 0; p < scanner.numPrograms(); p++) {
+        int f = scanner.getProgramFile(p);
+        if (f != mapped) {
+            map = new MemoryMappedFile(sorted[f], MemoryMappedFile::readOnly);
+            mapped = f;
+        }
+        int64 offset = scanner.getProgramOffset(p);
+        if ((map->getData() == nullptr) || (offset + SYSEX_PROGRAM_SIZE > (int64) map->getSize())) {
+            continue;    // changed again while we were at it, the next update gets it
+        }
+        FileEntry *e = decoded[f];
+        if (e->offsets.empty()) {
+            e->first = builder.size();
+        }
+        e->offsets.push_back(offset);
+        builder.add((const unsigned char *) map->getData() + offset, scanner.getValues(p), scanner.getName(p), scanner.getHash(p));
+    }
+    map = nullptr;
+
+    if (builder.size() > 0) {
+        Segment::Ptr segment(new Segment());
+        if (!segment->write(builder)) {
+            return;      // nowhere to put them, the files stay as they were and the next update tries again
+        }
+        for (int i = 0; i < decoded.size(); i++) {
+            if (!decoded[i]->offsets.empty()) {
+                decoded[i]->segment = segment;
+            }
+        }
+    }
+
+    {
+        const ScopedLock sl(lock);
+        for (int i = 0; i < decoded.size(); i++) {
+            place(decoded[i]);
+        }
+        decoded.clear(false);
+        counted();
+    }
+    compact();
+    changed();
+}
+
+// merges the libraries of the files into one, but for the biggest. the files decoded again
+// meanwhile are left alone.
+void LibraryIndex::compact()
+{
+    struct Moved {
+        String path;
+        Segment::Ptr segment;
+        int first, count, to;
+    };
+    vector<Moved> moved;
+    {
+        const ScopedLock sl(lock);
+        std::map<Segment *, int> used;
+        for (int i = 0; i < entries.size(); i++) {
+            if (entries[i]->segment != nullptr) {
+                used[entries[i]->segment] += (int) entries[i]->offsets.size();
+            }
+        }
+        if (used.size() <= MAX_SEGMENTS) {
+            return;
+        }
+        Segment *biggest = nullptr;
+        int most = -1;
+        for (std::map<Segment *, int>::const_iterator i = used.begin(); i != used.end(); ++i) {
+            if (i->second > most) {
+                biggest = i->first;
+                most = i->second;
+            }
+        }
+        for (int i = 0; i < entries.size(); i++) {
+            const FileEntry *e = entries[i];
+            if ((e->segment != nullptr) && (e->segment.get() != biggest)) {
+                Moved m;
+                m.path = e->path;
+                m.segment = e->segment;
+                m.first = e->first;
+                m.count = (int) e->offsets.size();
+                moved.push_back(m);
+            }
+        }
+    }
+
+    // the segments are held by moved, and what's in them doesn't change
+    PatchLibrary::Builder builder;
+    vector<int16> values(schema.numParams());
+    for (size_t i = 0; i < moved.size(); i++) {
+        const PatchLibrary &from = moved[i].segment->library;
+        moved[i].to = builder.size();
+        for (int p = moved[i].first; p < moved[i].first + moved[i].count; p++) {
+            from.getValues(p, &values[0]);
+            builder.add(from.getProgram(p), &values[0], from.getName(p), from.getHash(p));
+        }
+    }
+    Segment::Ptr merged(new Segment());
+    if (!merged->write(builder)) {
+        return;
+    }
+
+    const ScopedLock sl(lock);
+    for (size_t i = 0; i < moved.size(); i++) {
+        int at = findFile(moved[i].path);
+        if ((at >= 0) && (entries[at]->segment == moved[i].segment) && (entries[at]->first == moved[i].first)) {
+            entries[at]->segment = merged;
+            entries[at]->first = moved[i].to;
+        }
+    }
+}
+
+void LibraryIndex::remove(const Array<File> &files)
+{
+    bool removed = false;
+    {
+        const ScopedLock sl(lock);
+        for (int i = 0; i < files.size(); i++) {
+            int at = findFile(files[i].getFullPathName());
+            if (at >= 0) {
+                drop(at);
+                removed = true;
+            }
+        }
+        counted();
+    }
+    if (removed) {
+        changed();
+    }
+}
+
+void LibraryIndex::removeUnder(const File &directory)
+{
+    bool removed = false;
+    {
+        const ScopedLock sl(lock);
+        for (int i = entries.size(); --i >= 0;) {
+            if (entries[i]->file.isAChildOf(directory)) {
+                drop(i);
+                removed = true;
+            }
+        }
+        counted();
+    }
+    if (removed) {
+        changed();
+    }
+}
+
+void LibraryIndex::clear()
+{
+    {
+        const ScopedLock sl(lock);
+        entries.clear();
+        patches.clear();
+        numbers.clear();
+        counted();
+    }
+    changed();
+}
+
+bool LibraryIndex::isCurrent(const File &file) const
+{
+    const ScopedLock sl(lock);
+    int at = findFile(file.getFullPathName());
+    return (at >= 0) && (entries[at]->size == file.getSize()) && (entries[at]->modified == file.getLastModificationTime());
+}
+
+void LibraryIndex::getFiles(Array<File> &files) const
+{
+    const ScopedLock sl(lock);
+    files.clearQuick();
+    for (int i = 0; i < entries.size(); i++) {
+        files.add(entries[i]->file);
+    }
+}
+
+int LibraryIndex::numFiles() const
+{
+    const ScopedLock sl(lock);
+    return entries.size();
+}
+
+// where patch is, nullptr if there's no such patch. locked by the caller.
+const LibraryIndex::Location *LibraryIndex::findPatch(int patch) const
+{
+    if ((patch < 0) || (patch >= (int) patches.size()) || (patches[patch].entry == nullptr)) {
+        return nullptr;
+    }
+    return &patches[patch];
+}
+
+void LibraryIndex::fillPatch(const Location &at, Patch &p) const
+{
+    const FileEntry *e = at.entry;
+    const PatchLibrary &library = e->segment->library;
+    p.file = e->file;
+    p.offset = e->offsets[at.program];
+    p.name = library.getName(e->first + at.program);
+    p.hash = library.getHash(e->first + at.program);
+    p.category = library.getValue(e->first + at.program, categoryParam);
+}
+
+bool LibraryIndex::getPatch(int patch, Patch &p) const
+{
+    const ScopedLock sl(lock);
+    const Location *at = findPatch(patch);
+    if (at == nullptr) {
+        return false;
+    }
+    fillPatch(*at, p);
+    return true;
+}
+
+void LibraryIndex::getPatches(const int *patches, int count, Patch *p, bool *found) const
+{
+    const ScopedLock sl(lock);
+    for (int i = 0; i < count; i++) {
+        const Location *at = findPatch(patches[i]);
+        found[i] = (at != nullptr);
+        if (found[i]) {
+            fillPatch(*at, p[i]);
+        }
+    }
+}
+
+namespace {
+    struct Selected {
+        const char *name;        // in the mapping of a segment, held while selecting
+        int category;
+        int patch;
+    };
+
+    struct ByName {
+        bool operator()(const Selected &a, const Selected &b) const {
+            int c = CharPointer_UTF8(a.name).compareIgnoreCase(CharPointer_UTF8(b.name));
+            return (c != 0) ? (c < 0) : (a.patch < b.patch);
+        }
+    };
+
+    struct ByCategory {
+        bool operator()(const Selected &a, const Selected &b) const {
+            return (a.category != b.category) ? (a.category < b.category) : ByName()(a, b);
+        }
+    };
+}
+
+bool LibraryIndex::select(const String &query, Order order, vector<int> &patches) const
+{
+    // only what's needed to find the files' programs is copied under the lock, the
+    // queries run and the sort happens on the mapped libraries without it
+    struct Part {
+        Segment::Ptr segment;
+        int first;
+        vector<int> numbers;
+    };
+    vector<Part> parts;
+    {
+        const ScopedLock sl(lock);
+        for (int i = 0; i < entries.size(); i++) {
+            const FileEntry *e = entries[i];
+            if (e->segment != nullptr) {
+                parts.push_back(Part());
+                parts.back().segment = e->segment;
+                parts.back().first = e->first;
+                parts.back().numbers.assign(e->numbers->begin(), e->numbers->begin() + e->offsets.size());
+            }
+        }
+    }
+
+    vector<Selected> selected;
+    patches.clear();
+    for (size_t i = 0; i < parts.size(); i++) {
+        Segment &segment = *parts[i].segment;
+        const ScopedLock ql(segment.queryLock);
+        if (segment.query == nullptr) {
+            segment.query = new PatchQuery(segment.library);
+        }
+        // the same query on the same library again, it's only run for the first file in it
+        if (!segment.query->run(query)) {
+            patches.clear();
+            return false;
+        }
+        for (int p = 0; p < (int) parts[i].numbers.size(); p++) {
+            int row = parts[i].first + p;
+            if (!segment.query->matches(row)) {
+                continue;
+            }
+            if (order == BY_FILE) {
+                patches.push_back(parts[i].numbers[p]);
+                continue;
+            }
+            Selected s;
+            s.name = segment.library.getRawName(row);
+            s.category = segment.library.getValue(row, categoryParam);
+            s.patch = parts[i].numbers[p];
+            selected.push_back(s);
+        }
+    }
+    if (order == BY_NAME) {
+        sort(selected.begin(), selected.end(), ByName());
+    } else if (order == BY_CATEGORY) {
+        sort(selected.begin(), selected.end(), ByCategory());
+    }
+    for (size_t i = 0; i < selected.size(); i++) {
+        patches.push_back(selected[i].patch);
+    }
+    return true;
+}
+
+bool LibraryIndex::getValues(int patch, int16 *values) const
+{
+    const ScopedLock sl(lock);
+    const Location *at = findPatch(patch);
+    if (at == nullptr) {
+        return false;
+    }
+    at->entry->segment->library.getValues(at->entry->first + at->program, values);
+    return true;
+}
+
+bool LibraryIndex::getProgram(int patch, unsigned char *program) const
+{
+    const ScopedLock sl(lock);
+    const Location *at = findPatch(patch);
+    if (at == nullptr) {
+        return false;
+    }
+    memcpy(program, at->entry->segment->library.getProgram(at->entry->first + at->program), SYSEX_PROGRAM_SIZE);
+    return true;
+}
+
+bool LibraryIndex::write(const File &libraryFile) const
+{
+    PatchLibrary::Builder builder;
+    vector<int16> values(schema.numParams());
+    {
+        const ScopedLock sl(lock);
+        for (int i = 0; i < entries.size(); i++) {
+            const FileEntry *e = entries[i];
+            for (int p = e->first; p < e->first + (int) e->offsets.size(); p++) {
+                const PatchLibrary &library = e->segment->library;
+                library.getValues(p, &values[0]);
+                builder.add(library.getProgram(p), &values[0], library.getName(p), library.getHash(p));
+            }
+        }
+    }
+    return builder.write(libraryFile);
+}
+
+// a line per path, the path and then its numbers, runs of them as first-last
+String LibraryIndex::saveNumbers(const File &base) const
+{
+    const ScopedLock sl(lock);
+    String s;
+    for (std::map<String, vector<int> >::const_iterator i = numbers.begin(); i != numbers.end(); ++i) {
+        const vector<int> &n = i->second;
+        if (n.empty()) {
+            continue;
+        }
+        s << File(i->first).getRelativePathFrom(base) << "\t";
+        for (size_t p = 0; p < n.size();) {
+            size_t run = p + 1;
+            while ((run < n.size()) && (n[run] == n[run - 1] + 1)) {
+                run++;
+            }
+            s << ((p > 0) ? " " : "") << n[p];
+            if (run - p > 1) {
+                s << "-" << n[run - 1];
+            }
+            p = run;
+        }
+        s << "\n";
+    }
+    return s;
+}
+
+void LibraryIndex::restoreNumbers(const String &saved, const File &base)
+{
+    {
+        const ScopedLock sl(lock);
+        entries.clear();
+        patches.clear();
+        numbers.clear();
+
+        StringArray lines;
+        lines.addLines(saved);
+        for (int i = 0; i < lines.size(); i++) {
+            String path = lines[i].upToFirstOccurrenceOf("\t", false, false);
+            StringArray runs;
+            runs.addTokens(lines[i].fromFirstOccurrenceOf("\t", false, false), " ", String::empty);
+            if (path.isEmpty() || (runs.size() == 0)) {
+                continue;
+            }
+            vector<int> &n = numbers[base.getChildFile(path).getFullPathName()];
+            for (int r = 0; r < runs.size(); r++) {
+                int first = runs[r].upToFirstOccurrenceOf("-", false, false).getIntValue();
+                int last = runs[r].contains("-") ? runs[r].fromFirstOccurrenceOf("-", false, false).getIntValue() : first;
+                if ((first < 0) || (last < first) || (last >= MAX_NUMBERS)) {
+                    break;
+                }
+                if ((int) patches.size() <= last) {
+                    patches.resize(last + 1, Location());
+                }
+                // a number can only be had once, the rest of the file is numbered anew.
+                // program marks the taken ones until the end.
+                bool taken = false;
+                for (int k = first; !taken && (k <= last); k++) {
+                    taken = (patches[k].program != 0);
+                }
+                if (taken) {
+                    break;
+                }
+                for (int k = first; k <= last; k++) {
+                    patches[k].program = 1;
+                    n.push_back(k);
+                }
+            }
+        }
+        for (size_t i = 0; i < patches.size(); i++) {
+            patches[i].entry = nullptr;
+            patches[i].program = 0;
+        }
+        counted();
+    }
+    changed();
+}
@@ -0,0 +1,121 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _LIBRARYINDEX_H_
+#define _LIBRARYINDEX_H_
+
+#include "PatchLibrary.h"
+#include <map>
+
+// the decoded programs of a set of .syx files, kept per file so that a file can be
+// decoded again or dropped without touching the others. every update is written out
+// as a temporary PatchLibrary and used from its memory mapping, only the file offsets
+// of the programs are kept in memory.
+// a patch number is given to each program of a file the first time it is seen, in path
+// order, and stays with that file and program: a file added later doesn't move the
+// others, one that goes leaves a gap. saveNumbers() and restoreNumbers() carry the
+// numbers over to another session. safe to use from any thread; LibraryWatcher keeps
+// one up to date while the ui reads it.
+class LibraryIndex {
+   public:
+      class Listener {
+         public:
+            virtual ~Listener() {}
+            // on the thread that changed the index, with no lock held
+            virtual void libraryChanged(LibraryIndex &index) = 0;
+      };
+
+      struct Patch {
+         File file;
+         int64 offset;           // of the program dump in the file
+         String name;
+         uint64 hash;
+         int category;           // value of nrpn 666
+      };
+
+      enum Order {
+         BY_FILE,                // as they are in the files, the files by path
+         BY_NAME,
+         BY_CATEGORY             // then by name
+      };
+
+      LibraryIndex();
+      ~LibraryIndex();
+
+      void addListener(Listener *listener);
+      void removeListener(Listener *listener);
+
+      // decodes the files in parallel and puts their programs in place of what they had
+      void update(const Array<File> &files, int numThreads = 0);
+      void remove(const Array<File> &files);
+      void removeUnder(const File &directory);
+      void clear();              // the patch numbers too
+
+      // whether file is in the index with the size and time it has now
+      bool isCurrent(const File &file) const;
+      void getFiles(Array<File> &files) const;
+
+      int numFiles() const;
+      int numPatches() const { return patchCount.get(); }   // without waiting for the lock
+      int numNumbers() const { return numberCount.get(); }  // given out so far, gaps included
+      uint32 getVersion() const { return (uint32) version.get(); }   // changes with every change
+
+      // false if there is no such patch (any more)
+      bool getPatch(int patch, Patch &p) const;
+      bool getValues(int patch, int16 *values) const;      // IonSysexSchema::numParams()
+      bool getProgram(int patch, unsigned char *program) const;   // SYSEX_PROGRAM_SIZE
+      // count patches at once, false for the ones that aren't there (any more)
+      void getPatches(const int *patches, int count, Patch *p, bool *found) const;
+
+      // the numbers of the patches a PatchQuery matches, all of them for an empty one, in
+      // order. what a browser shows, without copying any patch. false and no patches if
+      // the query doesn't parse. a query typed a character at a time only runs its last
+      // clause again.
+      bool select(const String &query, Order order, vector<int> &patches) const;
+
+      // everything as a PatchLibrary file
+      bool write(const File &libraryFile) const;
+
+      // the patch numbers given out, with the paths relative to base. restoring them
+      // clears the index, the files get their numbers back as they are updated.
+      String saveNumbers(const File &base) const;
+      void restoreNumbers(const String &saved, const File &base);
+
+   private:
+      struct Segment;
+      struct FileEntry;
+      struct Location {
+         const FileEntry *entry;  // nullptr for a gap
+         int program;
+      };
+      int findFile(const String &path) const;
+      const Location *findPatch(int patch) const;
+      void fillPatch(const Location &at, Patch &p) const;
+      void place(FileEntry *e);
+      void drop(int at);
+      void compact();
+      void counted();
+      void changed();
+
+      const IonSysexSchema &schema;
+      const int categoryParam;
+      CriticalSection lock;
+      OwnedArray<FileEntry> entries;     // by path
+      vector<Location> patches;          // by patch number
+      std::map<String, vector<int> > numbers;   // of each path ever seen, by program
+      Atomic<int> version;
+      Atomic<int> patchCount;
+      Atomic<int> numberCount;
+      Array<Listener *> listeners;
+      CriticalSection listenerLock;
+
+      JUCE_DECLARE_NON_COPYABLE (LibraryIndex)
+};
+
+#endif
@@ -0,0 +1,227 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "LibraryWatcher.h"
+
+#if JUCE_LINUX
+#include <sys/inotify.h>
+#include <poll.h>
+#include <unistd.h>
+#include <map>
+#endif
+
+// how often the thread looks up from waiting to see if it should stop
+#define WAIT_INTERVAL 200
+
+// files written in quick succession are decoded together after things settle this long
+#define SETTLE_TIME 100
+
+LibraryWatcher::LibraryWatcher(LibraryIndex &i, const File &d, int p) :
+    Thread("library watcher"), index(i), directory(d), pollInterval(p)
+{
+}
+
+LibraryWatcher::~LibraryWatcher()
+{
+    stopThread(4 * WAIT_INTERVAL);
+}
+
+void LibraryWatcher::resync()
+{
+    const ScopedLock sl(syncLock);
+    Array<File> found, changed, gone, known;
+
+    SyxScanner::findSyxFiles(directory, true, found);
+    for (int i = 0; i < found.size(); i++) {
+        if (!index.isCurrent(found[i])) {
+            changed.add(found[i]);
+        }
+    }
+    index.getFiles(known);
+    for (int i = 0; i < known.size(); i++) {
+        if (known[i].isAChildOf(directory) && !known[i].existsAsFile()) {
+            gone.add(known[i]);
+        }
+    }
+    index.remove(gone);
+    index.update(changed);
+}
+
+void LibraryWatcher::run()
+{
+#if JUCE_LINUX
+    if (runNotified()) {
+        return;
+    }
+#endif
+    runPolling();
+}
+
+void LibraryWatcher::runPolling()
+{
+    notifications = 0;
+    while (!threadShouldExit()) {
+        resync();
+        for (int waited = 0; (waited < pollInterval) && !threadShouldExit(); waited += WAIT_INTERVAL) {
+            wait(WAIT_INTERVAL);
+        }
+    }
+}
+
+#if JUCE_LINUX
+
+// an inotify instance with a watch on every directory of the tree
+class LibraryWatcher::Notifier {
+public:
+    Notifier() {
+        fd = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+    }
+    ~Notifier() {
+        if (fd >= 0) {
+            close(fd);
+        }
+    }
+    bool isOpen() const { return fd >= 0; }
+
+    // the directory and everything under it, false if it can't be watched
+    bool watchTree(const File &dir) {
+        int wd = inotify_add_watch(fd, dir.getFullPathName().toRawUTF8(),
+                                   IN_CLOSE_WRITE | IN_MOVED_TO | IN_MOVED_FROM | IN_DELETE | IN_CREATE | IN_DELETE_SELF | IN_ONLYDIR);
+        if (wd < 0) {
+            return false;
+        }
+        dirs[wd] = dir;
+        Array<File> subdirs;
+        dir.findChildFiles(subdirs, File::findDirectories, false);
+        for (int i = 0; i < subdirs.size(); i++) {
+            watchTree(subdirs[i]);
+        }
+        return true;
+    }
+
+    // stops watching the directory and everything under it, for one moved out of the tree
+    // (a deleted one loses its watches by itself)
+    void unwatchTree(const File &dir) {
+        for (std::map<int, File>::iterator i = dirs.begin(); i != dirs.end();) {
+            if ((i->second == dir) || i->second.isAChildOf(dir)) {
+                inotify_rm_watch(fd, i->first);
+                dirs.erase(i++);
+            } else {
+                ++i;
+            }
+        }
+    }
+
+    void forget(int wd) {
+        dirs.erase(wd);
+    }
+
+    File dirOf(int wd) const {
+        std::map<int, File>::const_iterator i = dirs.find(wd);
+        return (i != dirs.end()) ? i->second : File::nonexistent;
+    }
+
+    bool wait(int ms) {
+        struct pollfd p;
+        p.fd = fd;
+        p.events = POLLIN;
+        p.revents = 0;
+        return poll(&p, 1, ms) > 0;
+    }
+
+    int read(void *buffer, size_t size) {
+        return (int) ::read(fd, buffer, size);
+    }
+
+private:
+    int fd;
+    std::map<int, File> dirs;
+};
+
+// false if inotify isn't there or runs out of watches before we even start
+bool LibraryWatcher::runNotified()
+{
+    Notifier notifier;
+    if (!notifier.isOpen() || !notifier.watchTree(directory)) {
+        return false;
+    }
+    notifications = 1;
+    resync();
+
+    // events are collected until the writing stops for SETTLE_TIME, so a file that's
+    // written in pieces or a whole directory copied in is decoded once
+    Array<File> changed, gone;
+    bool rescan = false;
+    char buffer[64 * 1024] __attribute__ ((aligned(__alignof__(struct inotify_event))));
+
+    while (!threadShouldExit()) {
+        bool pending = rescan || (changed.size() > 0) || (gone.size() > 0);
+        if (notifier.wait(pending ? SETTLE_TIME : WAIT_INTERVAL)) {
+            int n;
+            while ((n = notifier.read(buffer, sizeof(buffer))) > 0) {
+                for (char *p = buffer; p < buffer + n;) {
+                    const struct inotify_event *e = (const struct inotify_event *) p;
+                    p += sizeof(struct inotify_event) + e->len;
+
+                    if (e->mask & IN_Q_OVERFLOW) {
+                        rescan = true;
+                        continue;
+                    }
+                    if (e->mask & IN_IGNORED) {
+                        notifier.forget(e->wd);
+                        continue;
+                    }
+                    File dir = notifier.dirOf(e->wd);
+                    if ((e->mask & IN_DELETE_SELF) || (dir == File::nonexistent) || (e->len == 0)) {
+                        continue;
+                    }
+                    File file = dir.getChildFile(String::fromUTF8(e->name));
+                    if (e->mask & IN_ISDIR) {
+                        if (e->mask & (IN_CREATE | IN_MOVED_TO)) {
+                            // whatever landed in it before the watch did is picked up by the rescan
+                            notifier.watchTree(file);
+                            rescan = true;
+                        } else if (e->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                            if (e->mask & IN_MOVED_FROM) {
+                                notifier.unwatchTree(file);
+                            }
+                            index.removeUnder(file);
+                        }
+                    } else if (SyxScanner::isSyxFile(file)) {
+                        if (e->mask & (IN_CLOSE_WRITE | IN_MOVED_TO)) {
+                            gone.removeFirstMatchingValue(file);
+                            changed.addIfNotAlreadyThere(file);
+                        } else if (e->mask & (IN_DELETE | IN_MOVED_FROM)) {
+                            changed.removeFirstMatchingValue(file);
+                            gone.addIfNotAlreadyThere(file);
+                        }
+                    }
+                }
+            }
+            continue;
+        }
+
+        // quiet for a while, catch up
+        if (rescan) {
+            rescan = false;
+            changed.clearQuick();
+            gone.clearQuick();
+            resync();
+        } else if ((changed.size() > 0) || (gone.size() > 0)) {
+            const ScopedLock sl(syncLock);
+            index.remove(gone);
+            index.update(changed);
+            changed.clearQuick();
+            gone.clearQuick();
+        }
+    }
+    return true;
+}
+
+#endif
@@ -0,0 +1,49 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _LIBRARYWATCHER_H_
+#define _LIBRARYWATCHER_H_
+
+#include "LibraryIndex.h"
+
+// keeps a LibraryIndex in step with the .syx files under a directory, on its own thread.
+// on start every file that isn't current in the index is decoded and every file that's
+// gone is dropped, after that only what changes is. on linux the changes come from
+// inotify, elsewhere (or if inotify can't be had) the tree is looked over every
+// pollInterval ms, which only decodes files whose size or time changed.
+class LibraryWatcher : public Thread {
+   public:
+      LibraryWatcher(LibraryIndex &index, const File &directory, int pollInterval = 2000);
+      ~LibraryWatcher();    // stops the thread
+
+      const File &getDirectory() const { return directory; }
+      bool isUsingNotifications() const { return notifications.get() != 0; }
+
+      // decodes what changed and drops what's gone, from any thread
+      void resync();
+
+      void run();
+
+   private:
+      void runPolling();
+#if JUCE_LINUX
+      class Notifier;
+      bool runNotified();
+#endif
+
+      LibraryIndex &index;
+      const File directory;
+      const int pollInterval;
+      Atomic<int> notifications;
+      CriticalSection syncLock;
+
+      JUCE_DECLARE_NON_COPYABLE (LibraryWatcher)
+};
+
+#endif
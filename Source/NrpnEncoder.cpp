@@ -0,0 +1,145 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "NrpnEncoder.h"
+
+int encodeNrpn(int channel, int nrpn, int value, unsigned char *buf)
+{
+    unsigned char status = 0xb0 + (channel & 0x0f);
+
+    buf[0] = status;
+    buf[1] = 0x63;
+    buf[2] = (nrpn >> 7) & 0x7f;
+    buf[3] = status;
+    buf[4] = 0x62;
+    buf[5] = nrpn & 0x7f;
+    buf[6] = status;
+    buf[7] = 0x06;
+    buf[8] = (value >> 7) & 0x7f;
+    buf[9] = status;
+    buf[10] = 0x26;
+    buf[11] = value & 0x7f;
+    return NRPN_MSG_SIZE;
+}
+
+int encodeBankProgram(int channel, int bank, int program, unsigned char *buf)
+{
+    int n = 0;
+
+    if (bank > 0) {
+        // bank msb, then lsb
+        buf[n++] = 0xb0 + (channel & 0x0f);
+        buf[n++] = 0;
+        buf[n++] = 0;
+        buf[n++] = 0xb0 + (channel & 0x0f);
+        buf[n++] = 32;
+        buf[n++] = (bank - 1) & 0x7f;
+    }
+    if (program > 0) {
+        buf[n++] = 0xc0 + (channel & 0x0f);
+        buf[n++] = (program - 1) & 0x7f;
+    }
+    return n;
+}
+
+void NrpnStream::reset()
+{
+    runningStatus = -1;
+    for (int i = 0; i < 16; i++) {
+        selected[i] = -1;
+        dataMsb[i] = -1;
+    }
+}
+
+// one short message, without its status byte if that's still the running status
+int NrpnStream::put(int status, int data1, int data2, unsigned char *buf)
+{
+    int n = 0;
+
+    if (status != runningStatus) {
+        buf[n++] = (unsigned char) status;
+        runningStatus = status;
+    }
+    buf[n++] = (unsigned char) (data1 & 0x7f);
+    if (data2 >= 0) {
+        buf[n++] = (unsigned char) (data2 & 0x7f);
+    }
+    return n;
+}
+
+int NrpnStream::encodeNrpn(int channel, int nrpn, int value, unsigned char *buf)
+{
+    int ch = channel & 0x0f;
+    int status = 0xb0 + ch;
+    int n = 0;
+
+    nrpn &= 0x3fff;
+    if (selected[ch] != nrpn) {
+        // the number only needs the half that changed, as long as the other one is known
+        if ((selected[ch] < 0) || ((selected[ch] >> 7) != (nrpn >> 7))) {
+            n += put(status, 0x63, nrpn >> 7, buf + n);
+        }
+        if ((selected[ch] < 0) || ((selected[ch] & 0x7f) != (nrpn & 0x7f))) {
+            n += put(status, 0x62, nrpn & 0x7f, buf + n);
+        }
+        selected[ch] = nrpn;
+        // whether a newly selected nrpn keeps the last data msb or its own is up to the
+        // device, so it gets one
+        dataMsb[ch] = -1;
+    }
+    if (dataMsb[ch] != ((value >> 7) & 0x7f)) {
+        dataMsb[ch] = (value >> 7) & 0x7f;
+        n += put(status, 0x06, dataMsb[ch], buf + n);
+    }
+    // the lsb is what sets the value, it always goes out
+    n += put(status, 0x26, value & 0x7f, buf + n);
+    return n;
+}
+
+int NrpnStream::encodeBankProgram(int channel, int bank, int program, unsigned char *buf)
+{
+    int n = 0;
+
+    if (bank > 0) {
+        n += put(0xb0 + (channel & 0x0f), 0, 0, buf + n);
+        n += put(0xb0 + (channel & 0x0f), 32, bank - 1, buf + n);
+    }
+    if (program > 0) {
+        n += put(0xc0 + (channel & 0x0f), program - 1, -1, buf + n);
+    }
+    return n;
+}
+
+int encodeProgramNrpns(int channel, IonSysexParams &params, unsigned char *buf, int size, NrpnStream *stream)
+{
+    int n = 0;
+    int bank = params.getParamByNrpn(100)->getValue();
+    int program = params.getParamByNrpn(101)->getValue();
+
+    if (size < BANK_PROGRAM_MSG_SIZE) {
+        return 0;
+    }
+    n += stream ? stream->encodeBankProgram(channel, bank, program, buf) : encodeBankProgram(channel, bank, program, buf);
+
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        IonSysexParam *param = params.getParam(i);
+        if (!param->hasNrpn()) {
+            continue;
+        }
+        int nrpn = params.wireNrpn(i);
+        if (nrpn == NO_NRPN) {
+            continue;
+        }
+        if (n + NRPN_MSG_SIZE > size) {
+            break;
+        }
+        n += stream ? stream->encodeNrpn(channel, nrpn, param->getNrpnValue(), buf + n) : encodeNrpn(channel, nrpn, param->getNrpnValue(), buf + n);
+    }
+    return n;
+}
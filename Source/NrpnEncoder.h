@@ -0,0 +1,57 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _NRPNENCODER_H_
+#define _NRPNENCODER_H_
+
+#include "IonSysex.h"
+
+// the raw midi bytes the plugin sends to the hardware, without any midi device behind
+// them, so the plugin and the command line tools encode the same way. every function
+// writes into buf and returns the number of bytes it wrote.
+
+// largest encodeNrpn() and encodeBankProgram() output
+#define NRPN_MSG_SIZE 12
+#define BANK_PROGRAM_MSG_SIZE 8
+
+// nrpn and value as the four cc's 99, 98, 6, 38 on a channel from 0 to 15
+int encodeNrpn(int channel, int nrpn, int value, unsigned char *buf);
+
+// bank and program as the plugin's 1 based parameters, 0 leaves it out
+int encodeBankProgram(int channel, int bank, int program, unsigned char *buf);
+
+// the same messages for a device that remembers what it was last sent: the nrpn number
+// is left out while it's still selected on the channel, the data msb while it hasn't
+// changed for that nrpn, and the status byte while it's the running status. a knob sweep then costs 2 bytes a step
+// instead of 12. reset() whenever something else may have reached the device in between,
+// so the next message goes out whole, and endBatch() between messages that get sent
+// apart: the midi outputs take a batch as whole messages, so none starts in running status.
+class NrpnStream {
+   public:
+      NrpnStream() { reset(); }
+      void reset();
+      void endBatch() { runningStatus = -1; }
+
+      int encodeNrpn(int channel, int nrpn, int value, unsigned char *buf);
+      int encodeBankProgram(int channel, int bank, int program, unsigned char *buf);
+
+   private:
+      int put(int status, int data1, int data2, unsigned char *buf);
+
+      int runningStatus;       // -1 if not known
+      int selected[16];        // nrpn selected on each channel, -1 if not known
+      int dataMsb[16];         // data entry msb last sent on each channel, -1 if not known
+};
+
+// a whole program as bank/program change and the nrpn of every parameter that is sent,
+// like a sync to the hardware. stops early if size runs out. with a stream the messages
+// come out compressed as it would send them.
+int encodeProgramNrpns(int channel, IonSysexParams &params, unsigned char *buf, int size, NrpnStream *stream = nullptr);
+
+#endif
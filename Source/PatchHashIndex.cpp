@@ -0,0 +1,51 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "PatchHashIndex.h"
+
+PatchHashIndex::PatchHashIndex()
+{
+}
+
+PatchHashIndex::~PatchHashIndex()
+{
+}
+
+int PatchHashIndex::find(uint64 hash) const
+{
+    return patches.contains((int64) hash) ? patches[(int64) hash] : -1;
+}
+
+int PatchHashIndex::add(uint64 hash, int patch)
+{
+    int first = find(hash);
+    if (first < 0) {
+        patches.set((int64) hash, patch);
+    }
+    return first;
+}
+
+int PatchHashIndex::addBank(const IonSysexBank &bank, int firstPatch, Array<int> &unique)
+{
+    int duplicates = 0;
+    unique.clearQuick();
+    for (int i = 0; i < bank.numPrograms(); i++) {
+        if (add(bank.getHash(i), firstPatch + i) < 0) {
+            unique.add(i);
+        } else {
+            duplicates++;
+        }
+    }
+    return duplicates;
+}
+
+void PatchHashIndex::clear()
+{
+    patches.clear();
+}
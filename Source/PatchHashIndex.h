@@ -0,0 +1,46 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _PATCHHASHINDEX_H_
+#define _PATCHHASHINDEX_H_
+
+#include "IonSysexBank.h"
+
+// which sounds a library already has, by IonSysexSchema::canonicalHash(). finding a
+// hash is O(1), so a dump arriving from the hardware can be checked against any size
+// of library, and a whole library can be deduplicated in one pass.
+class PatchHashIndex {
+   public:
+      PatchHashIndex();
+      ~PatchHashIndex();
+
+      // the patch the hash was first added with, -1 if it's new
+      int find(uint64 hash) const;
+      bool contains(uint64 hash) const { return find(hash) >= 0; }
+
+      // returns what find() did before, so >= 0 means patch is a duplicate of that one
+      int add(uint64 hash, int patch);
+
+      // adds the programs of a bank as patches firstPatch and up. unique gets the
+      // programs that weren't in the index yet. returns how many were duplicates.
+      int addBank(const IonSysexBank &bank, int firstPatch, Array<int> &unique);
+
+      int size() const { return patches.size(); }
+      void clear();
+
+   private:
+      struct HashFunctions {
+         int generateHash(int64 key, int upperLimit) const { return (int) ((uint64) key % (uint64) upperLimit); }
+      };
+      HashMap<int64, int, HashFunctions> patches;
+
+      JUCE_DECLARE_NON_COPYABLE (PatchHashIndex)
+};
+
+#endif
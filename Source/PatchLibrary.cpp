@@ -0,0 +1,271 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "PatchLibrary.h"
+
+#define BYTE_ORDER_MARK 0x01020304
+
+static uint64 align8(uint64 n)
+{
+    return (n + 7) & ~(uint64) 7;
+}
+
+// whether count items of itemSize starting at offset end within size. checked so that
+// neither the sum nor the product can wrap around, whatever the header says.
+static bool fits(uint64 offset, uint64 count, uint64 itemSize, uint64 size)
+{
+    return (offset <= size) && ((itemSize == 0) || (count <= (size - offset) / itemSize));
+}
+
+static uint64 hashParameterTable()
+{
+    const IonSysexSchema &schema = IonSysexSchema::get();
+    String s;
+    for (int i = 0; i < schema.numParams(); i++) {
+        const IonSysexParamDesc &d = schema.getDesc(i);
+        s << d.name << "/" << d.nrpn << "/" << d.min << "/" << d.max << "/" << d.offset << ";";
+    }
+    return (uint64) s.hashCode64();
+}
+
+uint64 PatchLibrary::schemaHash()
+{
+    static const uint64 hash = hashParameterTable();
+    return hash;
+}
+
+PatchLibrary::PatchLibrary() :
+    schema(IonSysexSchema::get())
+{
+    header = nullptr;
+    base = nullptr;
+    patches = 0;
+    params = 0;
+}
+
+PatchLibrary::~PatchLibrary()
+{
+}
+
+void PatchLibrary::close()
+{
+    map = nullptr;
+    header = nullptr;
+    base = nullptr;
+    patches = 0;
+    params = 0;
+}
+
+bool PatchLibrary::open(const File &file)
+{
+    close();
+    ScopedPointer<MemoryMappedFile> m(new MemoryMappedFile(file, MemoryMappedFile::readOnly));
+    const PatchLibraryHeader *h = (const PatchLibraryHeader *) m->getData();
+    uint64 size = m->getSize();
+
+    if ((h == nullptr) || (size < sizeof(PatchLibraryHeader)) || (memcmp(h->magic, "MNAULIB", 8) != 0)) {
+        error = "not a patch library";
+        return false;
+    }
+    if ((h->version != PATCH_LIBRARY_VERSION) || (h->byteOrder != BYTE_ORDER_MARK)) {
+        error = "unsupported patch library version";
+        return false;
+    }
+    if ((h->numParams != (uint32) schema.numParams()) || (h->schemaHash != schemaHash())) {
+        error = "patch library was written for other parameters";
+        return false;
+    }
+    uint64 n = h->numPatches;
+    if ((h->fileSize != size) ||
+        (n > (uint64) INT_MAX) ||
+        !fits(h->namesOffset, n, PATCH_LIBRARY_NAME_SIZE, size) ||
+        !fits(h->hashesOffset, n, sizeof(uint64), size) ||
+        !fits(h->programsOffset, n, SYSEX_PROGRAM_SIZE, size) ||
+        (h->columnStride < n * sizeof(int16)) ||
+        !fits(h->columnsOffset, h->numParams, h->columnStride, size) ||
+        ((h->hashesOffset | h->columnsOffset | h->columnStride) & 7)) {
+        error = "patch library is damaged";
+        return false;
+    }
+
+    map = m.release();
+    header = h;
+    base = (const unsigned char *) h;
+    patches = (int) n;
+    params = (int) h->numParams;
+    error = String::empty;
+    return true;
+}
+
+const int16 *PatchLibrary::getColumn(int param) const
+{
+    return (const int16 *) (base + header->columnsOffset + header->columnStride * param);
+}
+
+void PatchLibrary::getValues(int patch, int16 *values) const
+{
+    for (int i = 0; i < params; i++) {
+        values[i] = getColumn(i)[patch];
+    }
+}
+
+const char *PatchLibrary::getRawName(int patch) const
+{
+    return (const char *) base + header->namesOffset + (uint64) patch * PATCH_LIBRARY_NAME_SIZE;
+}
+
+String PatchLibrary::getName(int patch) const
+{
+    const char *name = getRawName(patch);
+    return programNameToString(name, PATCH_LIBRARY_NAME_SIZE);
+}
+
+int PatchLibrary::getCategory(int patch) const
+{
+    return getValue(patch, schema.indexOfNrpn(666));
+}
+
+uint64 PatchLibrary::getHash(int patch) const
+{
+    return ((const uint64 *) (base + header->hashesOffset))[patch];
+}
+
+const unsigned char *PatchLibrary::getProgram(int patch) const
+{
+    return base + header->programsOffset + (uint64) patch * SYSEX_PROGRAM_SIZE;
+}
+
+PatchLibrary::Builder::Builder() :
+    schema(IonSysexSchema::get())
+{
+}
+
+PatchLibrary::Builder::~Builder()
+{
+}
+
+void PatchLibrary::Builder::add(const unsigned char *program, const int16 *v, const String &name, uint64 hash)
+{
+    char buf[PATCH_LIBRARY_NAME_SIZE];
+    memset(buf, 0, sizeof(buf));
+    name.copyToUTF8(buf, PATCH_LIBRARY_NAME_SIZE);
+
+    values.insert(values.end(), v, v + schema.numParams());
+    names.insert(names.end(), buf, buf + PATCH_LIBRARY_NAME_SIZE);
+    hashes.push_back(hash);
+    programs.insert(programs.end(), program, program + SYSEX_PROGRAM_SIZE);
+}
+
+bool PatchLibrary::Builder::add(const unsigned char *program, int size)
+{
+    vector<int16> v(schema.numParams());
+    char name[15];
+    for (int i = 0; i < schema.numParams(); i++) {
+        v[i] = (int16) schema.getDesc(i).min;
+    }
+    if (schema.decodeProgram(program, size, &v[0], name) != PROGRAM_OK) {
+        return false;
+    }
+    add(program, &v[0], programNameToString(name, sizeof(name)), schema.canonicalHash(&v[0]));
+    return true;
+}
+
+int PatchLibrary::Builder::addBank(const IonSysexBank &bank, const void *data)
+{
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.program >= 0) {
+            add((const unsigned char *) data + m.offset, bank.getValues(m.program), bank.getName(m.program), bank.getHash(m.program));
+        }
+    }
+    return bank.numPrograms();
+}
+
+int PatchLibrary::Builder::addScan(const SyxScanner &scanner)
+{
+    // the programs are in file order, so every file is mapped once
+    ScopedPointer<MemoryMappedFile> map;
+    int mapped = -1;
+    int added = 0;
+    for (int i = 0; i < scanner.numPrograms(); i++) {
+        int file = scanner.getProgramFile(i);
+        if (file != mapped) {
+            map = new MemoryMappedFile(scanner.getFile(file), MemoryMappedFile::readOnly);
+            mapped = file;
+        }
+        int64 offset = scanner.getProgramOffset(i);
+        if ((map->getData() == nullptr) || (offset + SYSEX_PROGRAM_SIZE > (int64) map->getSize())) {
+            continue;    // changed since the scan
+        }
+        add((const unsigned char *) map->getData() + offset, scanner.getValues(i), scanner.getName(i), scanner.getHash(i));
+        added++;
+    }
+    return added;
+}
+
+int PatchLibrary::Builder::addLibrary(const PatchLibrary &library)
+{
+    vector<int16> v(schema.numParams());
+    for (int i = 0; i < library.numPatches(); i++) {
+        library.getValues(i, &v[0]);
+        add(library.getProgram(i), &v[0], library.getName(i), library.getHash(i));
+    }
+    return library.numPatches();
+}
+
+bool PatchLibrary::Builder::write(const File &file) const
+{
+    PatchLibraryHeader h;
+    uint64 n = hashes.size();
+    int stride = schema.numParams();
+
+    memset(&h, 0, sizeof(h));
+    memcpy(h.magic, "MNAULIB", 8);
+    h.version = PATCH_LIBRARY_VERSION;
+    h.byteOrder = BYTE_ORDER_MARK;
+    h.numPatches = (uint32) n;
+    h.numParams = (uint32) stride;
+    h.schemaHash = schemaHash();
+    h.namesOffset = align8(sizeof(h));
+    h.hashesOffset = align8(h.namesOffset + n * PATCH_LIBRARY_NAME_SIZE);
+    h.programsOffset = align8(h.hashesOffset + n * sizeof(uint64));
+    h.columnsOffset = align8(h.programsOffset + n * SYSEX_PROGRAM_SIZE);
+    h.columnStride = align8(n * sizeof(int16));
+    h.fileSize = h.columnsOffset + h.columnStride * stride;
+
+    // written next to the file and moved over it, so readers never see half a library
+    TemporaryFile temp(file);
+    {
+        FileOutputStream out(temp.getFile());
+        if (out.failedToOpen()) {
+            return false;
+        }
+        const char zeros[8] = { 0 };
+        out.write(&h, sizeof(h));
+        out.write(zeros, (size_t) (h.namesOffset - sizeof(h)));
+        out.write(names.data(), names.size());
+        out.write(zeros, (size_t) (h.hashesOffset - h.namesOffset - names.size()));
+        out.write(hashes.data(), hashes.size() * sizeof(uint64));
+        out.write(programs.data(), programs.size());
+        out.write(zeros, (size_t) (h.columnsOffset - h.programsOffset - programs.size()));
+
+        vector<int16> column((size_t) (h.columnStride / sizeof(int16)), 0);
+        for (int p = 0; p < stride; p++) {
+            for (uint64 i = 0; i < n; i++) {
+                column[(size_t) i] = values[(size_t) i * stride + p];
+            }
+            out.write(column.data(), (size_t) h.columnStride);
+        }
+        out.flush();
+        if (out.getStatus().failed() || ((uint64) out.getPosition() != h.fileSize)) {
+            return false;
+        }
+    }
+    return temp.overwriteTargetFileWithTemporary();
+}
@@ -0,0 +1,107 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _PATCHLIBRARY_H_
+#define _PATCHLIBRARY_H_
+
+#include "SyxScanner.h"
+
+// a library of decoded programs on disk, used straight from a memory mapping.
+// the file holds, each section 8 byte aligned:
+//   header         PatchLibraryHeader
+//   names          16 bytes per patch, nul terminated
+//   hashes         IonSysexSchema::canonicalHash() per patch
+//   programs       the SYSEX_PROGRAM_SIZE byte dump each patch was read from
+//   columns        per parameter, in schema order, the int16 value of every patch
+// so filtering on one parameter only touches the pages of its column.
+
+#define PATCH_LIBRARY_VERSION 1
+#define PATCH_LIBRARY_NAME_SIZE 16
+
+struct PatchLibraryHeader {
+   char magic[8];             // "MNAULIB", nul terminated
+   uint32 version;
+   uint32 byteOrder;          // 0x01020304 as written, all numbers are native
+   uint32 numPatches;
+   uint32 numParams;
+   uint64 schemaHash;         // of the parameter table the columns were written for
+   uint64 namesOffset;
+   uint64 hashesOffset;
+   uint64 programsOffset;
+   uint64 columnsOffset;
+   uint64 columnStride;       // bytes from one column to the next
+   uint64 fileSize;
+};
+
+class PatchLibrary {
+   public:
+      PatchLibrary();
+      ~PatchLibrary();
+
+      // maps the file, nothing is decoded. false if it isn't a library, or one written
+      // for another parameters.xml, see getError().
+      bool open(const File &file);
+      void close();
+      bool isOpen() const { return map != nullptr; }
+      const String &getError() const { return error; }
+
+      int numPatches() const { return patches; }
+      int numParams() const { return params; }
+
+      // numPatches() values of one parameter
+      const int16 *getColumn(int param) const;
+      int getValue(int patch, int param) const { return getColumn(param)[patch]; }
+      void getValues(int patch, int16 *values) const;    // numParams() of them
+      String getName(int patch) const;
+      const char *getRawName(int patch) const;           // utf8, nul terminated
+      int getCategory(int patch) const;
+      uint64 getHash(int patch) const;
+      const unsigned char *getProgram(int patch) const;  // bit exact as it was read
+
+      // fingerprint of the parameter table, changes whenever the columns would
+      static uint64 schemaHash();
+
+      // collects programs and writes them out as a library
+      class Builder {
+         public:
+            Builder();
+            ~Builder();
+
+            bool add(const unsigned char *program, int size);   // false if not a good program
+            void add(const unsigned char *program, const int16 *values, const String &name, uint64 hash);
+            int addBank(const IonSysexBank &bank, const void *data);
+            int addScan(const SyxScanner &scanner);           // rereads the program dumps
+            int addLibrary(const PatchLibrary &library);
+            int size() const { return (int) hashes.size(); }
+
+            bool write(const File &file) const;
+
+         private:
+            const IonSysexSchema &schema;
+            vector<int16> values;          // a row of numParams() per patch
+            vector<char> names;
+            vector<uint64> hashes;
+            vector<unsigned char> programs;
+
+            JUCE_DECLARE_NON_COPYABLE (Builder)
+      };
+
+   private:
+      const IonSysexSchema &schema;
+      ScopedPointer<MemoryMappedFile> map;
+      const PatchLibraryHeader *header;
+      const unsigned char *base;
+      int patches;
+      int params;
+      String error;
+
+      JUCE_DECLARE_NON_COPYABLE (PatchLibrary)
+};
+
+#endif
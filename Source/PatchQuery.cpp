@@ -0,0 +1,431 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "PatchQuery.h"
+#include <algorithm>
+
+#ifndef JUCE_USE_SSE_INTRINSICS
+ #define JUCE_USE_SSE_INTRINSICS 1
+#endif
+
+#if ! JUCE_INTEL
+ #undef JUCE_USE_SSE_INTRINSICS
+#endif
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <emmintrin.h>
+#endif
+
+#define MOD_SLOTS 12
+#define MOD_SOURCE_NRPN 692     // slot n's source is 692 + 4 * n, its dest one more
+
+static int countBits(uint64 x)
+{
+#if defined(__GNUC__)
+    return __builtin_popcountll(x);
+#else
+    x = x - ((x >> 1) & 0x5555555555555555ULL);
+    x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+    x = (x + (x >> 4)) & 0x0f0f0f0f0f0f0f0fULL;
+    return (int) ((x * 0x0101010101010101ULL) >> 56);
+#endif
+}
+
+// bit i set if lo <= v[i] <= hi, for the n <= 64 values at v
+static uint64 rangeBits(const int16 *v, int n, int lo, int hi)
+{
+    uint64 bits = 0;
+#if JUCE_USE_SSE_INTRINSICS
+    if (n == 64) {
+        const __m128i l = _mm_set1_epi16((int16) lo);
+        const __m128i h = _mm_set1_epi16((int16) hi);
+        for (int i = 0; i < 64; i += 16) {
+            __m128i a = _mm_loadu_si128((const __m128i *) (v + i));
+            __m128i b = _mm_loadu_si128((const __m128i *) (v + i + 8));
+            __m128i outA = _mm_or_si128(_mm_cmplt_epi16(a, l), _mm_cmpgt_epi16(a, h));
+            __m128i outB = _mm_or_si128(_mm_cmplt_epi16(b, l), _mm_cmpgt_epi16(b, h));
+            uint32 out = (uint32) _mm_movemask_epi8(_mm_packs_epi16(outA, outB));
+            bits |= (uint64) (~out & 0xffff) << i;
+        }
+        return bits;
+    }
+#endif
+    for (int i = 0; i < n; i++) {
+        if ((v[i] >= lo) && (v[i] <= hi)) {
+            bits |= (uint64) 1 << i;
+        }
+    }
+    return bits;
+}
+
+static uint64 setBits(const int16 *v, int n, const vector<PatchQuery::Range> &ranges)
+{
+    uint64 bits = 0;
+    for (size_t r = 0; r < ranges.size(); r++) {
+        bits |= rangeBits(v, n, ranges[r].lo, ranges[r].hi);
+    }
+    return bits;
+}
+
+// lower case without spaces or underscores, for matching parameter names
+static String squeeze(const String &s)
+{
+    return s.toLowerCase().removeCharacters(" _");
+}
+
+static void toRanges(vector<int> &values, vector<PatchQuery::Range> &ranges)
+{
+    sort(values.begin(), values.end());
+    ranges.clear();
+    for (size_t i = 0; i < values.size(); i++) {
+        if (!ranges.empty() && (values[i] <= ranges.back().hi + 1)) {
+            ranges.back().hi = jmax(ranges.back().hi, values[i]);
+        } else {
+            PatchQuery::Range r = { values[i], values[i] };
+            ranges.push_back(r);
+        }
+    }
+}
+
+static bool isNumber(const String &s)
+{
+    return s.isNotEmpty() && s.substring(s[0] == '-' ? 1 : 0).containsOnly("0123456789") && (s != "-");
+}
+
+PatchQuery::PatchQuery(const PatchLibrary &l) :
+    library(l), schema(IonSysexSchema::get())
+{
+    int n = library.numPatches();
+    words = (n + 63) / 64;
+    all.assign(words, ~(uint64) 0);
+    if (n % 64) {
+        all[words - 1] = ((uint64) 1 << (n % 64)) - 1;
+    }
+    haveTrigrams = false;
+}
+
+PatchQuery::~PatchQuery()
+{
+}
+
+bool PatchQuery::run(const String &text)
+{
+    StringArray clauses;
+    String rest = text;
+    int at;
+    while ((at = rest.indexOfIgnoreCase(" and ")) >= 0) {
+        clauses.add(rest.substring(0, at));
+        rest = rest.substring(at + 5);
+    }
+    if (rest.trim().isNotEmpty() || (clauses.size() > 0)) {
+        clauses.add(rest);
+    }
+
+    error = String::empty;
+    for (int i = 0; i < clauses.size(); i++) {
+        String key = clauses[i].trim().toLowerCase().replace("  ", " ");
+        if ((i < (int) keys.size()) && (keys[i] == key)) {
+            continue;   // same as last time, and so is everything before it
+        }
+        keys.resize(i);
+        bits.resize(i);
+        counts.resize(i);
+
+        Clause c;
+        if (!parseClause(clauses[i].trim(), c)) {
+            return false;
+        }
+        bits.push_back(vector<uint64>(words, 0));
+        evaluate(c, (i > 0) ? bits[i - 1] : all, bits[i]);
+        int count = 0;
+        for (int w = 0; w < words; w++) {
+            count += countBits(bits[i][w]);
+        }
+        keys.push_back(key);
+        counts.push_back(count);
+    }
+    keys.resize(clauses.size());
+    bits.resize(clauses.size());
+    counts.resize(clauses.size());
+    return true;
+}
+
+bool PatchQuery::matches(int patch) const
+{
+    const vector<uint64> &result = bits.empty() ? all : bits.back();
+    return (result[patch / 64] >> (patch % 64)) & 1;
+}
+
+void PatchQuery::getMatches(Array<int> &patches, int max) const
+{
+    const vector<uint64> &result = bits.empty() ? all : bits.back();
+    patches.clearQuick();
+    for (int w = 0; (w < words) && (patches.size() < max); w++) {
+        uint64 b = result[w];
+        while (b && (patches.size() < max)) {
+            int i = 0;
+            while (!((b >> i) & 1)) {
+                i++;
+            }
+            patches.add(w * 64 + i);
+            b &= b - 1;
+        }
+    }
+}
+
+// the parameter called name, or else the one with the shortest name starting with it
+int PatchQuery::findParam(const String &name) const
+{
+    String want = squeeze(name);
+    int best = -1;
+    int bestLength = 0;
+    for (int i = 0; i < schema.numParams(); i++) {
+        if (schema.fieldOfParam[i] < 0) {
+            continue;
+        }
+        const IonSysexParamDesc &d = schema.getDesc(i);
+        String names[2] = { squeeze(d.name), d.paramName ? squeeze(d.paramName) : String::empty };
+        for (int k = 0; k < 2; k++) {
+            if (names[k] == want) {
+                return i;
+            }
+            if (names[k].startsWith(want) && ((best < 0) || (names[k].length() < bestLength))) {
+                best = i;
+                bestLength = names[k].length();
+            }
+        }
+    }
+    return best;
+}
+
+bool PatchQuery::parseValues(int param, const String &op, const String &value, Clause &c)
+{
+    const IonSysexParamDesc &d = schema.getDesc(param);
+    vector<int> found;
+
+    c.negate = (op == "!=");
+    if (isNumber(value)) {
+        int v = value.getIntValue();
+        Range r = { -32768, 32767 };
+        if ((op == "=") || (op == "!=")) {
+            r.lo = r.hi = v;
+        } else if (op == "<") {
+            r.hi = v - 1;
+        } else if (op == "<=") {
+            r.hi = v;
+        } else if (op == ">") {
+            r.lo = v + 1;
+        } else if (op == ">=") {
+            r.lo = v;
+        } else {
+            error = "can't use " + op + " on a number";
+            return false;
+        }
+        r.lo = jmax(r.lo, -32768);
+        r.hi = jmin(r.hi, 32767);
+        if (r.lo <= r.hi) {
+            c.values.push_back(r);
+        }
+        return true;
+    }
+    if ((op != "=") && (op != "!=")) {
+        error = "can't use " + op + " on \"" + value + "\"";
+        return false;
+    }
+
+    // list items that are value, or else the ones starting with it
+    const vector<ListItemParameter> &list = schema.getList(param);
+    for (int pass = 0; (pass < 2) && found.empty(); pass++) {
+        for (size_t i = 0; i < list.size(); i++) {
+            String item(list[i].getName());
+            if ((pass == 0) ? item.equalsIgnoreCase(value) : item.startsWithIgnoreCase(value)) {
+                found.push_back((int) i - d.cntrlOffset);
+            }
+        }
+    }
+    int v;
+    if (found.empty() && schema.findTextValue(param, value, v)) {
+        found.push_back(v);
+    }
+    if (found.empty()) {
+        error = String(d.name) + " is never \"" + value + "\"";
+        return false;
+    }
+    toRanges(found, c.values);
+    return true;
+}
+
+bool PatchQuery::parseClause(const String &text, Clause &c)
+{
+    c.negate = false;
+    c.param = -1;
+
+    if (text.startsWithIgnoreCase("mod ") && text.contains("->")) {
+        String source = text.substring(4).upToFirstOccurrenceOf("->", false, false).trim();
+        String dest = text.fromFirstOccurrenceOf("->", false, false).trim();
+        Clause s, t;
+        if (!parseValues(schema.indexOfNrpn(MOD_SOURCE_NRPN), "=", source, s) ||
+            !parseValues(schema.indexOfNrpn(MOD_SOURCE_NRPN + 1), "=", dest, t)) {
+            return false;
+        }
+        c.kind = Clause::MOD_ROUTE;
+        c.values = s.values;
+        c.dest = t.values;
+        return true;
+    }
+
+    int at = text.indexOfAnyOf("!<>=~");
+    if (at <= 0) {
+        error = "\"" + text + "\" needs an operator";
+        return false;
+    }
+    int opLength = (text[at + 1] == '=') ? 2 : 1;
+    String name = text.substring(0, at).trim();
+    String op = text.substring(at, at + opLength);
+    String value = text.substring(at + opLength).trim().unquoted();
+
+    if (name.equalsIgnoreCase("name")) {
+        if (op != "~") {
+            error = "names are searched with ~";
+            return false;
+        }
+        c.kind = Clause::NAME;
+        c.text = value.toLowerCase();
+        return true;
+    }
+    if ((op == "~") || (op == "!")) {
+        error = "\"" + op + "\" isn't an operator";
+        return false;
+    }
+    c.kind = Clause::VALUE;
+    c.param = findParam(name);
+    if (c.param < 0) {
+        error = "no parameter \"" + name + "\"";
+        return false;
+    }
+    return parseValues(c.param, op, value, c);
+}
+
+void PatchQuery::evaluate(const Clause &c, const vector<uint64> &in, vector<uint64> &out)
+{
+    int n = library.numPatches();
+
+    if (c.kind == Clause::NAME) {
+        evaluateName(c.text, in, out);
+        return;
+    }
+    const int16 *column = (c.kind == Clause::VALUE) ? library.getColumn(c.param) : nullptr;
+    for (int w = 0; w < words; w++) {
+        if (in[w] == 0) {
+            out[w] = 0;
+            continue;
+        }
+        int first = w * 64;
+        int count = jmin(64, n - first);
+        uint64 m = 0;
+        if (c.kind == Clause::VALUE) {
+            m = setBits(column + first, count, c.values);
+        } else {
+            for (int slot = 0; slot < MOD_SLOTS; slot++) {
+                const int16 *source = library.getColumn(schema.indexOfNrpn(MOD_SOURCE_NRPN + 4 * slot));
+                const int16 *dest = library.getColumn(schema.indexOfNrpn(MOD_SOURCE_NRPN + 4 * slot + 1));
+                m |= setBits(source + first, count, c.values) & setBits(dest + first, count, c.dest);
+            }
+        }
+        out[w] = in[w] & (c.negate ? ~m : m);
+    }
+}
+
+static void lowerName(const char *raw, char *name)
+{
+    int i;
+    for (i = 0; (i < PATCH_LIBRARY_NAME_SIZE - 1) && raw[i]; i++) {
+        name[i] = (char) tolower((unsigned char) raw[i]);
+    }
+    name[i] = 0;
+}
+
+static uint32 trigramAt(const char *s)
+{
+    return ((uint32) (uint8) s[0] << 16) | ((uint32) (uint8) s[1] << 8) | (uint8) s[2];
+}
+
+void PatchQuery::buildTrigrams()
+{
+    vector<uint64> pairs;      // trigram << 32 | patch
+    char name[PATCH_LIBRARY_NAME_SIZE];
+    for (int p = 0; p < library.numPatches(); p++) {
+        lowerName(library.getRawName(p), name);
+        for (int i = 0; name[i] && name[i + 1] && name[i + 2]; i++) {
+            pairs.push_back(((uint64) trigramAt(&name[i]) << 32) | (uint32) p);
+        }
+    }
+    sort(pairs.begin(), pairs.end());
+    pairs.erase(unique(pairs.begin(), pairs.end()), pairs.end());
+
+    trigrams.clear();
+    postingStart.clear();
+    postings.resize(pairs.size());
+    for (size_t i = 0; i < pairs.size(); i++) {
+        uint32 t = (uint32) (pairs[i] >> 32);
+        if (trigrams.empty() || (trigrams.back() != t)) {
+            trigrams.push_back(t);
+            postingStart.push_back((int) i);
+        }
+        postings[i] = (int) (uint32) pairs[i];
+    }
+    postingStart.push_back((int) pairs.size());
+    haveTrigrams = true;
+}
+
+void PatchQuery::evaluateName(const String &text, const vector<uint64> &in, vector<uint64> &out)
+{
+    char want[PATCH_LIBRARY_NAME_SIZE + 1];
+    char name[PATCH_LIBRARY_NAME_SIZE];
+    text.copyToUTF8(want, sizeof(want));
+    int length = (int) strlen(want);
+
+    out.assign(words, 0);
+    if (length > PATCH_LIBRARY_NAME_SIZE - 1) {
+        return;
+    }
+
+    // the candidates have the rarest trigram of text, shorter texts look at every name
+    vector<int> candidates;
+    bool everyName = (length < 3);
+    if (!everyName) {
+        if (!haveTrigrams) {
+            buildTrigrams();
+        }
+        int rarest = -1;
+        for (int i = 0; i + 2 < length; i++) {
+            vector<uint32>::const_iterator t = lower_bound(trigrams.begin(), trigrams.end(), trigramAt(&want[i]));
+            if ((t == trigrams.end()) || (*t != trigramAt(&want[i]))) {
+                return;     // no name has it
+            }
+            int k = (int) (t - trigrams.begin());
+            if ((rarest < 0) || (postingStart[k + 1] - postingStart[k] < postingStart[rarest + 1] - postingStart[rarest])) {
+                rarest = k;
+            }
+        }
+        candidates.assign(postings.begin() + postingStart[rarest], postings.begin() + postingStart[rarest + 1]);
+    }
+
+    int n = everyName ? library.numPatches() : (int) candidates.size();
+    for (int i = 0; i < n; i++) {
+        int p = everyName ? i : candidates[i];
+        if (!((in[p / 64] >> (p % 64)) & 1)) {
+            continue;
+        }
+        lowerName(library.getRawName(p), name);
+        if (strstr(name, want) != NULL) {
+            out[p / 64] |= (uint64) 1 << (p % 64);
+        }
+    }
+}
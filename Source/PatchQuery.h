@@ -0,0 +1,82 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _PATCHQUERY_H_
+#define _PATCHQUERY_H_
+
+#include "PatchLibrary.h"
+
+// structured search over a PatchLibrary, e.g.
+//   filter1 type = mg 4-pole LP and env3 attack < 200 and category = bass and mod LFO1 -> pitch
+// clauses are joined by "and":
+//   <param> <op> <value>   op is one of = != < <= > >=. param is a parameter name, or
+//                          the start of one, spaces and case don't matter. numbers are
+//                          raw values, text is a list item, or the start of some.
+//   mod <source> -> <dest> any mod matrix slot routes source to dest, as list items
+//   name ~ <text>          the name contains text, ignoring case
+// every clause is a scan of one column (a few for mod) into a bitset of the patches,
+// only looking at the 64 patch words the clauses before it left something in. the
+// results of the clauses a query starts with are kept, so a query that is being typed
+// only scans its last clause again.
+class PatchQuery {
+   public:
+      PatchQuery(const PatchLibrary &library);
+      ~PatchQuery();
+
+      // false if text doesn't parse, see getError(). what parsed up to there is run.
+      bool run(const String &text);
+      const String &getError() const { return error; }
+
+      int numMatches() const { return counts.empty() ? library.numPatches() : counts.back(); }
+      bool matches(int patch) const;
+      void getMatches(Array<int> &patches, int max = 0x7fffffff) const;
+
+      int numClauses() const { return (int) counts.size(); }
+      int getClauseCount(int clause) const { return counts[clause]; }   // matches after it
+
+      struct Range {
+         int lo, hi;
+      };
+
+   private:
+      struct Clause {
+         enum Kind { VALUE, MOD_ROUTE, NAME } kind;
+         int param;
+         vector<Range> values;     // the value is in one of them, for MOD_ROUTE the source
+         vector<Range> dest;
+         bool negate;
+         String text;              // for NAME, lower case
+      };
+
+      bool parseClause(const String &text, Clause &c);
+      int findParam(const String &name) const;
+      bool parseValues(int param, const String &op, const String &value, Clause &c);
+      void evaluate(const Clause &c, const vector<uint64> &in, vector<uint64> &out);
+      void evaluateName(const String &text, const vector<uint64> &in, vector<uint64> &out);
+      void buildTrigrams();
+
+      const PatchLibrary &library;
+      const IonSysexSchema &schema;
+      int words;
+      vector<uint64> all;                   // every patch
+      vector<String> keys;                  // normalised text of each clause run
+      vector< vector<uint64> > bits;        // patches left after each clause
+      vector<int> counts;
+      String error;
+
+      // trigrams of the lower case names, sorted, with the patches having each
+      vector<uint32> trigrams;
+      vector<int> postingStart;             // one more than trigrams
+      vector<int> postings;
+      bool haveTrigrams;
+
+      JUCE_DECLARE_NON_COPYABLE (PatchQuery)
+};
+
+#endif
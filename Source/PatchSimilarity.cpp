@@ -0,0 +1,304 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "PatchSimilarity.h"
+#include <algorithm>
+
+#ifndef JUCE_USE_SSE_INTRINSICS
+ #define JUCE_USE_SSE_INTRINSICS 1
+#endif
+
+#if ! JUCE_INTEL
+ #undef JUCE_USE_SSE_INTRINSICS
+#endif
+
+#if JUCE_USE_SSE_INTRINSICS
+ #include <emmintrin.h>
+#endif
+
+// largest per parameter weight. a weighted scaled difference (255 * 63) still fits an
+// int16 and a whole distance an int32.
+#define MAX_WEIGHT 63
+#define FULL_RANGE (255 * 255)
+
+static int paddedSize(int n)
+{
+    return (n + 15) & ~15;
+}
+
+PatchSimilarity::Group PatchSimilarity::groupOf(int nrpn)
+{
+    if ((nrpn >= 512) && (nrpn <= 522)) {
+        return VOICE;
+    }
+    if ((nrpn >= 523) && (nrpn <= 554)) {
+        return (nrpn == 553) ? FILTERS : OSCILLATORS;
+    }
+    if (((nrpn >= 555) && (nrpn <= 573)) || (nrpn == 670)) {
+        return FILTERS;
+    }
+    if ((nrpn >= 574) && (nrpn <= 577)) {
+        return EFFECTS;
+    }
+    if ((nrpn >= 578) && (nrpn <= 616)) {
+        return ENVELOPES;
+    }
+    if (((nrpn >= 617) && (nrpn <= 629)) || ((nrpn >= 671) && (nrpn <= 673))) {
+        return LFOS;
+    }
+    if ((nrpn >= 630) && (nrpn <= 665)) {
+        return TRACKING;
+    }
+    if ((nrpn >= 692) && (nrpn <= 739)) {
+        return MOD_MATRIX;
+    }
+    if ((nrpn == 742) || ((nrpn >= 800) && (nrpn <= 948))) {
+        return EFFECTS;
+    }
+    return NUM_GROUPS;
+}
+
+PatchSimilarity::PatchSimilarity() :
+    schema(IonSysexSchema::get())
+{
+    patches = 0;
+
+    // the parameters stored in a program that make up the sound. fx parameters share
+    // their storage between the fx types, only the first one at an offset is used.
+    for (int i = 0; i < schema.numParams(); i++) {
+        const IonSysexParamDesc &desc = schema.getDesc(i);
+        if ((schema.fieldOfParam[i] < 0) || (groupOf(desc.nrpn) == NUM_GROUPS) ||
+            (schema.indexOfOffset(desc.offset) != i) || (desc.max <= desc.min)) {
+            continue;
+        }
+        if (desc.conv == IonSysexParam::LIST) {
+            listed.push_back(i);
+        } else {
+            numeric.push_back(i);
+        }
+    }
+    numericSize = paddedSize((int) numeric.size());
+    listedSize = paddedSize((int) listed.size());
+    stride = numericSize + listedSize;
+
+    for (int g = 0; g < NUM_GROUPS; g++) {
+        groupWeight[g] = 1.0f;
+    }
+    updateWeights();
+}
+
+PatchSimilarity::~PatchSimilarity()
+{
+}
+
+void PatchSimilarity::setGroupWeight(Group group, float weight)
+{
+    groupWeight[group] = jmax(0.0f, weight);
+    updateWeights();
+}
+
+// every parameter gets its group's weight split evenly over the group, scaled so the
+// heaviest one gets MAX_WEIGHT
+void PatchSimilarity::updateWeights()
+{
+    int count[NUM_GROUPS] = { 0 };
+    for (size_t i = 0; i < numeric.size(); i++) {
+        count[groupOf(schema.getDesc(numeric[i]).nrpn)]++;
+    }
+    for (size_t i = 0; i < listed.size(); i++) {
+        count[groupOf(schema.getDesc(listed[i]).nrpn)]++;
+    }
+    float perParam[NUM_GROUPS];
+    float heaviest = 0;
+    for (int g = 0; g < NUM_GROUPS; g++) {
+        perParam[g] = count[g] ? groupWeight[g] / count[g] : 0;
+        heaviest = jmax(heaviest, perParam[g]);
+    }
+
+    numericWeight.assign(numericSize, 0);
+    listedWeight.assign(listedSize, 0);
+    maxDistance = 0;
+    if (heaviest <= 0) {
+        return;
+    }
+    for (size_t i = 0; i < numeric.size(); i++) {
+        float w = perParam[groupOf(schema.getDesc(numeric[i]).nrpn)];
+        numericWeight[i] = (w > 0) ? (int16) jmax(1, roundToInt(MAX_WEIGHT * w / heaviest)) : 0;
+        maxDistance += (double) numericWeight[i] * FULL_RANGE;
+    }
+    for (size_t i = 0; i < listed.size(); i++) {
+        float w = perParam[groupOf(schema.getDesc(listed[i]).nrpn)];
+        listedWeight[i] = (w > 0) ? (uint8) jmax(1, roundToInt(MAX_WEIGHT * w / heaviest)) : 0;
+        maxDistance += (double) listedWeight[i] * FULL_RANGE;
+    }
+}
+
+void PatchSimilarity::encode(const int16 *values, uint8 *row) const
+{
+    memset(row, 0, stride);
+    for (size_t i = 0; i < numeric.size(); i++) {
+        const IonSysexParamDesc &desc = schema.getDesc(numeric[i]);
+        int range = desc.max - desc.min;
+        int v = jlimit(desc.min, desc.max, (int) values[numeric[i]]) - desc.min;
+        row[i] = (uint8) ((v * 255 + range / 2) / range);
+    }
+    for (size_t i = 0; i < listed.size(); i++) {
+        const IonSysexParamDesc &desc = schema.getDesc(listed[i]);
+        row[numericSize + i] = (uint8) jlimit(0, 255, values[listed[i]] - desc.min);
+    }
+}
+
+int PatchSimilarity::add(const int16 *values)
+{
+    rows.resize((size_t) (patches + 1) * stride);
+    encode(values, &rows[(size_t) patches * stride]);
+    return patches++;
+}
+
+int PatchSimilarity::add(IonSysexParams &params)
+{
+    vector<int16> values(params.numParams());
+    for (unsigned int i = 0; i < params.numParams(); i++) {
+        values[i] = (int16) params.getParam(i)->getValue();
+    }
+    return add(&values[0]);
+}
+
+int PatchSimilarity::addBank(const IonSysexBank &bank)
+{
+    int first = patches;
+    reserve(patches + bank.numPrograms());
+    for (int i = 0; i < bank.numPrograms(); i++) {
+        add(bank.getValues(i));
+    }
+    return first;
+}
+
+void PatchSimilarity::reserve(int n)
+{
+    rows.reserve((size_t) n * stride);
+}
+
+void PatchSimilarity::clear()
+{
+    rows.clear();
+    patches = 0;
+}
+
+// sum of weight * difference^2 over the scaled parameters plus FULL_RANGE * weight for
+// every list parameter that differs. wide is the query's scaled part as int16. gives up
+// with whatever it has once the scaled part alone is over limit.
+uint32 PatchSimilarity::distance(const uint8 *query, const int16 *wide, const uint8 *row, uint32 limit) const
+{
+    uint32 scaled, lists;
+#if JUCE_USE_SSE_INTRINSICS
+    const __m128i zero = _mm_setzero_si128();
+    __m128i acc = zero;
+    for (int i = 0; i < numericSize; i += 16) {
+        __m128i r = _mm_loadu_si128((const __m128i *) (row + i));
+        __m128i lo = _mm_sub_epi16(_mm_loadu_si128((const __m128i *) (wide + i)), _mm_unpacklo_epi8(r, zero));
+        __m128i hi = _mm_sub_epi16(_mm_loadu_si128((const __m128i *) (wide + i + 8)), _mm_unpackhi_epi8(r, zero));
+        __m128i wlo = _mm_loadu_si128((const __m128i *) (&numericWeight[i]));
+        __m128i whi = _mm_loadu_si128((const __m128i *) (&numericWeight[i + 8]));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(lo, _mm_mullo_epi16(lo, wlo)));
+        acc = _mm_add_epi32(acc, _mm_madd_epi16(hi, _mm_mullo_epi16(hi, whi)));
+    }
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0x4e));
+    acc = _mm_add_epi32(acc, _mm_shuffle_epi32(acc, 0xb1));
+    scaled = (uint32) _mm_cvtsi128_si32(acc);
+    if (scaled > limit) {
+        return scaled;
+    }
+
+    __m128i sad = zero;
+    for (int i = 0; i < listedSize; i += 16) {
+        __m128i same = _mm_cmpeq_epi8(_mm_loadu_si128((const __m128i *) (query + numericSize + i)),
+                                      _mm_loadu_si128((const __m128i *) (row + numericSize + i)));
+        __m128i w = _mm_loadu_si128((const __m128i *) (&listedWeight[i]));
+        sad = _mm_add_epi64(sad, _mm_sad_epu8(_mm_andnot_si128(same, w), zero));
+    }
+    lists = (uint32) (_mm_cvtsi128_si32(sad) + _mm_cvtsi128_si32(_mm_srli_si128(sad, 8)));
+#else
+    scaled = 0;
+    for (int i = 0; i < numericSize; i++) {
+        int d = wide[i] - row[i];
+        scaled += (uint32) (d * d * numericWeight[i]);
+    }
+    if (scaled > limit) {
+        return scaled;
+    }
+    lists = 0;
+    for (int i = 0; i < listedSize; i++) {
+        if (query[numericSize + i] != row[numericSize + i]) {
+            lists += listedWeight[i];
+        }
+    }
+#endif
+    return scaled + lists * FULL_RANGE;
+}
+
+namespace {
+    struct Candidate {
+        uint32 distance;
+        int patch;
+        bool operator< (const Candidate &other) const {
+            return (distance < other.distance) || ((distance == other.distance) && (patch < other.patch));
+        }
+    };
+}
+
+int PatchSimilarity::query(const int16 *values, int k, Array<Match> &matches, int exclude) const
+{
+    vector<uint8> query(stride);
+    encode(values, &query[0]);
+    return queryRow(&query[0], k, matches, exclude);
+}
+
+int PatchSimilarity::queryPatch(int patch, int k, Array<Match> &matches) const
+{
+    return queryRow(&rows[(size_t) patch * stride], k, matches, patch);
+}
+
+int PatchSimilarity::queryRow(const uint8 *query, int k, Array<Match> &matches, int exclude) const
+{
+    vector<int16> wide(numericSize);
+    for (int i = 0; i < numericSize; i++) {
+        wide[i] = query[i];
+    }
+
+    // the k best so far as a max heap, so the one to beat is always at the front
+    vector<Candidate> best;
+    k = jmin(k, patches - ((exclude >= 0) && (exclude < patches) ? 1 : 0));
+    best.reserve(jmax(0, k));
+    for (int p = 0; (p < patches) && (k > 0); p++) {
+        if (p == exclude) {
+            continue;
+        }
+        bool full = ((int) best.size() == k);
+        uint32 d = distance(query, &wide[0], &rows[(size_t) p * stride], full ? best.front().distance : 0xffffffff);
+        if (!full) {
+            best.push_back({ d, p });
+            std::push_heap(best.begin(), best.end());
+        } else if (d < best.front().distance) {
+            std::pop_heap(best.begin(), best.end());
+            best.back() = { d, p };
+            std::push_heap(best.begin(), best.end());
+        }
+    }
+    std::sort_heap(best.begin(), best.end());
+
+    matches.clearQuick();
+    for (size_t i = 0; i < best.size(); i++) {
+        Match m;
+        m.patch = best[i].patch;
+        m.distance = (maxDistance > 0) ? (float) (best[i].distance / maxDistance) : 0.0f;
+        matches.add(m);
+    }
+    return matches.size();
+}
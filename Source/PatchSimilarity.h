@@ -0,0 +1,84 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _PATCHSIMILARITY_H_
+#define _PATCHSIMILARITY_H_
+
+#include "IonSysexBank.h"
+
+// "sounds like this one" over any number of decoded programs. every program is kept as
+// one byte per sound parameter: the value scaled from min .. max to 0 .. 255, or the
+// item for list parameters, which only count as equal or not. the distance weights
+// every parameter group the same no matter how many parameters it has, then by the
+// group weights.
+class PatchSimilarity {
+   public:
+      enum Group {
+         VOICE = 0,          // unison, portamento, sync, fm
+         OSCILLATORS,        // oscillators, ring mod, noise, ext in
+         FILTERS,            // filters and their routing
+         ENVELOPES,
+         LFOS,               // lfo 1 and 2, s&h
+         MOD_MATRIX,
+         TRACKING,
+         EFFECTS,            // drive, output, fx1 and fx2
+         NUM_GROUPS
+      };
+
+      struct Match {
+         int patch;
+         float distance;     // 0 is the same sound, 1 every parameter as far off as can be
+      };
+
+      PatchSimilarity();
+      ~PatchSimilarity();
+
+      // 0 leaves a group out, the default is 1 for all of them
+      void setGroupWeight(Group group, float weight);
+      float getGroupWeight(Group group) const { return groupWeight[group]; }
+
+      // values are IonSysexSchema::numParams() long, as decoded by IonSysexBank.
+      // every add returns the index of the (first) added patch.
+      int add(const int16 *values);
+      int add(IonSysexParams &params);
+      int addBank(const IonSysexBank &bank);
+      void reserve(int patches);
+      void clear();
+      int size() const { return patches; }
+
+      // the k closest patches, closest first. exclude leaves out one patch, e.g. the one
+      // the query came from. returns how many were found.
+      int query(const int16 *values, int k, Array<Match> &matches, int exclude = -1) const;
+      int queryPatch(int patch, int k, Array<Match> &matches) const;
+
+      static Group groupOf(int nrpn);      // NUM_GROUPS if not a sound parameter
+
+   private:
+      void encode(const int16 *values, uint8 *row) const;
+      void updateWeights();
+      int queryRow(const uint8 *query, int k, Array<Match> &matches, int exclude) const;
+      uint32 distance(const uint8 *query, const int16 *wide, const uint8 *row, uint32 limit) const;
+
+      const IonSysexSchema &schema;
+      vector<int> numeric;            // schema indexes of the scaled parameters
+      vector<int> listed;             // and of the list ones
+      int numericSize, listedSize;    // both padded to 16 bytes
+      int stride;
+      vector<uint8> rows;             // stride bytes per patch
+      int patches;
+
+      float groupWeight[NUM_GROUPS];
+      vector<int16> numericWeight;    // per byte of a row, 0 for the padding
+      vector<uint8> listedWeight;
+      double maxDistance;
+
+      JUCE_DECLARE_NON_COPYABLE (PatchSimilarity)
+};
+
+#endif
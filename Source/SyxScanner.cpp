@@ -0,0 +1,194 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "SyxScanner.h"
+
+#define NAME_SIZE 15
+#define PROGRESS_INTERVAL 100
+
+// what one file came to, merged into the scanner's rows in file order at the end
+struct SyxScanner::FileResult {
+    vector<int16> values;
+    vector<char> names;
+    vector<uint64> hashes;
+    vector<int64> offsets;
+    int errors;
+    bool mapped;
+};
+
+class SyxScanner::ScanJob : public ThreadPoolJob
+{
+public:
+    ScanJob(SyxScanner &s) : ThreadPoolJob("syx scan"), scanner(s) {
+    }
+    JobStatus runJob() {
+        scanner.scanNext(bank);
+        return jobHasFinished;
+    }
+private:
+    SyxScanner &scanner;
+    IonSysexBank bank;
+};
+
+SyxScanner::SyxScanner() :
+    schema(IonSysexSchema::get())
+{
+    errors = 0;
+    fileErrors = 0;
+}
+
+SyxScanner::~SyxScanner()
+{
+}
+
+void SyxScanner::clear()
+{
+    files.clearQuick();
+    results.clear();
+    values.clear();
+    names.clear();
+    hashes.clear();
+    programFile.clear();
+    programOffset.clear();
+    errors = 0;
+    fileErrors = 0;
+}
+
+void SyxScanner::cancel()
+{
+    cancelled = 1;
+}
+
+bool SyxScanner::isSyxFile(const File &file)
+{
+    return file.hasFileExtension("syx");
+}
+
+// findChildFiles() matches its wildcard case sensitively on linux
+void SyxScanner::findSyxFiles(const File &directory, bool recursive, Array<File> &found)
+{
+    Array<File> files;
+    directory.findChildFiles(files, File::findFiles, recursive, "*");
+    for (int i = 0; i < files.size(); i++) {
+        if (isSyxFile(files[i])) {
+            found.add(files[i]);
+        }
+    }
+}
+
+bool SyxScanner::scan(const File &directory, bool recursive, int numThreads, Listener *listener)
+{
+    Array<File> found;
+    findSyxFiles(directory, recursive, found);
+    return scanFiles(found, numThreads, listener);
+}
+
+bool SyxScanner::scanFiles(const Array<File> &toScan, int numThreads, Listener *listener)
+{
+    clear();
+    files = toScan;
+    for (int i = 0; i < files.size(); i++) {
+        results.add(nullptr);
+    }
+    nextFile = 0;
+    filesDone = 0;
+    programsFound = 0;
+    cancelled = 0;
+
+    // one job per thread, each working through the files until there are none left
+    if (numThreads <= 0) {
+        numThreads = SystemStats::getNumCpus();
+    }
+    int jobs = jmax(1, jmin(numThreads, files.size()));
+    {
+        ThreadPool pool(jobs);
+        OwnedArray<ScanJob> running;
+        for (int i = 0; i < jobs; i++) {
+            pool.addJob(running.add(new ScanJob(*this)), false);
+        }
+        for (int i = 0; i < running.size(); i++) {
+            while (!pool.waitForJobToFinish(running[i], PROGRESS_INTERVAL)) {
+                if (listener != nullptr) {
+                    listener->scanProgress(filesDone.get(), files.size(), programsFound.get());
+                }
+            }
+        }
+    }
+
+    // merge in file order. a cancelled scan keeps the files that were done.
+    int stride = schema.numParams();
+    values.reserve((size_t) programsFound.get() * stride);
+    for (int i = 0; i < files.size(); i++) {
+        const FileResult *r = results[i];
+        if (r == nullptr) {
+            continue;
+        }
+        if (!r->mapped) {
+            fileErrors++;
+        }
+        errors += r->errors;
+        values.insert(values.end(), r->values.begin(), r->values.end());
+        names.insert(names.end(), r->names.begin(), r->names.end());
+        hashes.insert(hashes.end(), r->hashes.begin(), r->hashes.end());
+        programOffset.insert(programOffset.end(), r->offsets.begin(), r->offsets.end());
+        programFile.insert(programFile.end(), r->hashes.size(), i);
+    }
+    results.clear();
+
+    if (listener != nullptr) {
+        listener->scanProgress(filesDone.get(), files.size(), programsFound.get());
+    }
+    return cancelled.get() == 0;
+}
+
+// runs on the worker threads, every file is taken by exactly one of them
+void SyxScanner::scanNext(IonSysexBank &bank)
+{
+    int stride = schema.numParams();
+    int idx;
+    while ((cancelled.get() == 0) && ((idx = ++nextFile - 1) < files.size())) {
+        FileResult *r = new FileResult();
+        r->errors = 0;
+
+        MemoryMappedFile map(files.getReference(idx), MemoryMappedFile::readOnly);
+        r->mapped = (map.getData() != nullptr) || (files.getReference(idx).getSize() == 0);
+        if (map.getData() != nullptr) {
+            bank.parse(map.getData(), map.getSize(), 1);
+            int n = bank.numPrograms();
+            r->errors = bank.numErrors();
+            r->values.resize((size_t) n * stride);
+            r->names.resize((size_t) n * NAME_SIZE);
+            for (int p = 0; p < n; p++) {
+                memcpy(&r->values[(size_t) p * stride], bank.getValues(p), stride * sizeof(int16));
+                r->hashes.push_back(bank.getHash(p));
+            }
+            for (int m = 0; m < bank.numMessages(); m++) {
+                const IonSysexBank::Message &msg = bank.getMessage(m);
+                if (msg.program >= 0) {
+                    r->offsets.push_back(msg.offset);
+                    bank.getName(msg.program).copyToUTF8(&r->names[(size_t) msg.program * NAME_SIZE], NAME_SIZE);
+                }
+            }
+            programsFound += n;
+        }
+        results.set(idx, r);
+        filesDone += 1;
+    }
+}
+
+const int16 *SyxScanner::getValues(int program) const
+{
+    return &values[(size_t) program * schema.numParams()];
+}
+
+String SyxScanner::getName(int program) const
+{
+    const char *name = &names[(size_t) program * NAME_SIZE];
+    return programNameToString(name, NAME_SIZE);
+}
@@ -0,0 +1,80 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _SYXSCANNER_H_
+#define _SYXSCANNER_H_
+
+#include "IonSysexBank.h"
+
+// loads every .syx file under a directory. the files are memory mapped and parsed
+// in place by a pool of worker threads, each taking the next file when it's done
+// with one, so a big archive keeps all cores busy. the result is in file order,
+// the same for any number of threads.
+class SyxScanner {
+   public:
+      class Listener {
+         public:
+            virtual ~Listener() {}
+            // on the thread that called scan(), every PROGRESS_INTERVAL ms and at the end
+            virtual void scanProgress(int filesDone, int filesTotal, int programs) = 0;
+      };
+
+      SyxScanner();
+      ~SyxScanner();
+
+      // .syx files whatever the case of the extension, so every part of the library
+      // agrees on which files it holds
+      static bool isSyxFile(const File &file);
+      static void findSyxFiles(const File &directory, bool recursive, Array<File> &found);
+
+      // blocks until every file is done or cancel() is called. numThreads <= 0 uses
+      // one per cpu. returns false if cancelled, what was done so far is kept.
+      bool scan(const File &directory, bool recursive = true, int numThreads = 0, Listener *listener = nullptr);
+      bool scanFiles(const Array<File> &files, int numThreads = 0, Listener *listener = nullptr);
+      void cancel();        // from any thread
+      void clear();
+
+      int numFiles() const { return files.size(); }
+      const File &getFile(int idx) const { return files.getReference(idx); }
+      int numFileErrors() const { return fileErrors; }    // files that couldn't be mapped
+      int numErrors() const { return errors; }            // cut off messages and bad checksums
+
+      // the good programs of all files, in file order
+      int numPrograms() const { return (int) programFile.size(); }
+      const int16 *getValues(int program) const;
+      String getName(int program) const;
+      uint64 getHash(int program) const { return hashes[program]; }
+      int getProgramFile(int program) const { return programFile[program]; }
+      int64 getProgramOffset(int program) const { return programOffset[program]; }
+
+   private:
+      struct FileResult;
+      class ScanJob;
+      void scanNext(IonSysexBank &bank);
+
+      const IonSysexSchema &schema;
+      Array<File> files;
+      OwnedArray<FileResult, CriticalSection> results;   // per file while scanning
+      Atomic<int> nextFile;
+      Atomic<int> filesDone;
+      Atomic<int> programsFound;
+      Atomic<int> cancelled;
+
+      vector<int16> values;        // a row of numParams() per program
+      vector<char> names;          // a row of 15 per program
+      vector<uint64> hashes;
+      vector<int> programFile;
+      vector<int64> programOffset;
+      int errors;
+      int fileErrors;
+
+      JUCE_DECLARE_NON_COPYABLE (SyxScanner)
+};
+
+#endif
@@ -0,0 +1,93 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "TransmitQueue.h"
+
+// how often an idle queue looks for dirty slots. post() doesn't wake the thread, as that
+// would take a lock on the audio thread.
+#define POLL_INTERVAL 2
+
+TransmitQueue::TransmitQueue(Target &t, int n, int micros) :
+    Thread("transmit queue"), target(t), microsPerByte(micros), slots(n, true), numSlots(n)
+{
+    startThread(7);
+}
+
+TransmitQueue::~TransmitQueue()
+{
+    stopThread(2000);
+}
+
+void TransmitQueue::post(int slot, int value)
+{
+    if ((slot < 0) || (slot >= numSlots)) {
+        return;
+    }
+    // counted before the dirty bit is published, so the sender can't take the slot and
+    // count it off first. meanwhile pending may be one too high, never too low.
+    slots[slot].value = value;
+    ++pending;
+    if (!slots[slot].dirty.compareAndSetBool(1, 0)) {
+        --pending;
+    }
+    ++posted;
+}
+
+void TransmitQueue::discard()
+{
+    for (int i = 0; i < numSlots; i++) {
+        if (slots[i].dirty.compareAndSetBool(0, 1)) {
+            --pending;
+        }
+    }
+}
+
+bool TransmitQueue::waitUntilSent(int timeoutMs)
+{
+    uint32 start = Time::getMillisecondCounter();
+    while (pending.get() > 0) {
+        if (Time::getMillisecondCounter() - start >= (uint32) timeoutMs) {
+            return false;
+        }
+        Thread::sleep(1);
+    }
+    return true;
+}
+
+void TransmitQueue::run()
+{
+    // when the link is free again, in high resolution ticks
+    int64 due = Time::getHighResolutionTicks();
+    const double ticksPerMicro = Time::getHighResolutionTicksPerSecond() / 1e6;
+
+    while (!threadShouldExit()) {
+        bool any = false;
+        for (int i = 0; (i < numSlots) && !threadShouldExit(); i++) {
+            if (!slots[i].dirty.compareAndSetBool(0, 1)) {
+                continue;
+            }
+            any = true;
+            int bytes = target.transmit(i, slots[i].value.get());
+            ++sent;
+            --pending;
+
+            // wait while the bytes are on the wire, so whatever changes meanwhile
+            // replaces its value in the slot instead of queueing up behind it
+            int64 now = Time::getHighResolutionTicks();
+            due = jmax(due, now) + (int64) (bytes * microsPerByte * ticksPerMicro);
+            int ms = (int) ((due - now) / (ticksPerMicro * 1000));
+            if (ms > 0) {
+                wait(ms);
+            }
+        }
+        if (!any) {
+            wait(POLL_INTERVAL);
+        }
+    }
+}
@@ -0,0 +1,63 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef _TRANSMITQUEUE_H_
+#define _TRANSMITQUEUE_H_
+
+#include "DeviceShadow.h"
+
+// parameter changes on their way to the hardware. post() only stores the value in the
+// parameter's slot and marks it dirty, so it never blocks or takes a lock. a thread of
+// its own polls for dirty slots and sends them no faster than the link takes them, by
+// then a parameter that was changed again in between is sent just once, with its
+// latest value.
+class TransmitQueue : public Thread {
+   public:
+      // the midi side, called on the queue's thread
+      class Target {
+         public:
+            virtual ~Target() {}
+            virtual int transmit(int slot, int value) = 0;    // returns the bytes sent
+      };
+
+      TransmitQueue(Target &target, int numSlots, int microsPerByte = MIDI_BYTE_MICROS);
+      ~TransmitQueue();    // stops the thread, whatever is still dirty isn't sent
+
+      // any thread, lock free
+      void post(int slot, int value);
+
+      // forgets what's dirty, e.g. when something else already sent the latest values
+      void discard();
+
+      // true once everything posted so far has gone out
+      bool waitUntilSent(int timeoutMs);
+
+      int64 numPosted() const { return posted.get(); }
+      int64 numSent() const { return sent.get(); }
+
+      void run();
+
+   private:
+      struct Slot {
+         Atomic<int> value;
+         Atomic<int> dirty;
+      };
+
+      Target &target;
+      const int microsPerByte;
+      HeapBlock<Slot> slots;
+      const int numSlots;
+      Atomic<int> pending;     // dirty slots, or being sent
+      Atomic<int64> posted;
+      Atomic<int64> sent;
+
+      JUCE_DECLARE_NON_COPYABLE (TransmitQueue)
+};
+
+#endif
@@ -0,0 +1,579 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// batch processing of .syx files without the plugin. directories are searched for *.syx,
+// the files are processed on -j threads and the output comes in the order they were given.
+
+#include "../IonSysexBank.h"
+#include "../NrpnEncoder.h"
+#include "../PatchHashIndex.h"
+#include "../PatchQuery.h"
+#include "../LibraryWatcher.h"
+#include <signal.h>
+
+static const char *usage =
+    "usage: micronau-cli <command> [options] <.syx file or directory>...\n"
+    "\n"
+    "commands:\n"
+    "  inspect      list the messages and programs of every file\n"
+    "  validate     report broken messages and bad checksums, exit 1 if there are any\n"
+    "  rechecksum   fix bad checksums, in place or into the -o directory\n"
+    "  convert      re-encode the good programs into the -o file, or with --split one\n"
+    "               file per program into the -o directory\n"
+    "  json         print the programs and their parameter values as json\n"
+    "  scan         load everything under the given directories, with progress, and\n"
+    "               count the programs, errors and distinct sounds. ctrl-c stops it\n"
+    "  pack         scan like scan does and write the programs as a patch library to -o\n"
+    "  unpack       write the program dumps of patch libraries to the -o file, bit exact\n"
+    "  query        list the patches of patch libraries matching -q, see PatchQuery.h\n"
+    "  dedup        copy the programs into the -o file, leaving out every one that\n"
+    "               sounds the same as one before it, whatever its name\n"
+    "  watch        follow the given directories, printing what changes and, with -o,\n"
+    "               rewriting the patch library there after every change. ctrl-c stops it\n"
+    "\n"
+    "options:\n"
+    "  -j <n>       worker threads, default one per cpu\n"
+    "  -o <path>    output file or directory\n"
+    "  --split      convert to one file per program\n"
+    "  --nrpn       convert to the raw midi a sync via nrpn sends instead of sysex\n"
+    "  -c <n>       midi channel of --nrpn, 1 to 16, default 1\n"
+    "  -q <query>   e.g. \"filter 1 type = mg and category = bass and name ~ sub\"\n";
+
+enum Command {
+    INSPECT,
+    VALIDATE,
+    RECHECKSUM,
+    CONVERT,
+    EXPORT_JSON,
+    DEDUP,
+    SCAN,
+    PACK,
+    UNPACK,
+    QUERY,
+    WATCH
+};
+
+static Command command;
+static int threads = 0;
+static File out;
+static bool split = false;
+static bool nrpn = false;
+static int channel = 0;
+static String queryText;
+
+// what processing a file leaves for main() to write out in order
+struct FileResult {
+    File file;
+    String text;           // for stdout
+    MemoryBlock data;      // appended to the convert or dedup output file
+    vector<uint64> hashes; // of the programs in data, for dedup
+    bool failed;
+};
+
+static const char *statusText(ProgramStatus status)
+{
+    switch (status) {
+        case PROGRAM_OK:           return "ok";
+        case PROGRAM_BAD_SIZE:     return "bad size";
+        case PROGRAM_NOT_PROGRAM:  return "not a program dump";
+        case PROGRAM_BAD_CHECKSUM: return "bad checksum";
+    }
+    return "unknown";
+}
+
+static String jsonString(const String &s)
+{
+    String r("\"");
+    for (String::CharPointerType p = s.getCharPointer(); !p.isEmpty(); ++p) {
+        juce_wchar c = *p;
+        if ((c == '"') || (c == '\\')) {
+            r << '\\' << String::charToString(c);
+        } else if (c < 0x20) {
+            r << "\\u" << String::toHexString((int) c).paddedLeft('0', 4);
+        } else {
+            r << String::charToString(c);
+        }
+    }
+    return r + "\"";
+}
+
+static void inspect(FileResult &r, const IonSysexBank &bank)
+{
+    r.text << r.file.getFullPathName() << ": " << bank.numMessages() << " messages, "
+           << bank.numPrograms() << " programs, " << bank.numErrors() << " errors\n";
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        r.text << String::formatted("  %4d  offset %8lld  %6d bytes  ", i, (long long) m.offset, m.size);
+        if (m.program >= 0) {
+            r.text << String::formatted("program %4d  ", m.program) << bank.getName(m.program) << "\n";
+        } else {
+            r.text << statusText(m.status) << "\n";
+        }
+    }
+}
+
+static void validate(FileResult &r, const IonSysexBank &bank)
+{
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if ((m.status == PROGRAM_BAD_SIZE) || (m.status == PROGRAM_BAD_CHECKSUM)) {
+            r.text << r.file.getFullPathName() << ": message " << i << " at offset "
+                   << String(m.offset) << ": " << statusText(m.status) << "\n";
+        }
+    }
+    if (bank.numErrors() > 0) {
+        r.failed = true;
+    } else {
+        r.text << r.file.getFullPathName() << ": ok, " << bank.numPrograms() << " programs\n";
+    }
+}
+
+static void rechecksum(FileResult &r, const IonSysexBank &bank, MemoryBlock &data)
+{
+    int fixed = 0;
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.status == PROGRAM_BAD_CHECKSUM) {
+            rechecksumProgram((unsigned char *) data.getData() + m.offset, m.size);
+            fixed++;
+        }
+    }
+    File dest = (out == File::nonexistent) ? r.file : out.getChildFile(r.file.getFileName());
+    if (((fixed > 0) || (dest != r.file)) && !dest.replaceWithData(data.getData(), data.getSize())) {
+        r.text << dest.getFullPathName() << ": can't write\n";
+        r.failed = true;
+        return;
+    }
+    r.text << dest.getFullPathName() << ": " << fixed << " checksums fixed\n";
+}
+
+static void convert(FileResult &r, const IonSysexBank &bank, const MemoryBlock &data)
+{
+    IonSysexParams params;
+    HeapBlock<unsigned char> buf(BANK_PROGRAM_MSG_SIZE + params.numParams() * NRPN_MSG_SIZE);
+    int programs = 0;
+
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.program < 0) {
+            continue;
+        }
+        params.readProgramContent((const unsigned char *) data.getData() + m.offset + 1, SYSEX_CONTENT_SIZE);
+        int n;
+        if (nrpn) {
+            n = encodeProgramNrpns(channel, params, buf, BANK_PROGRAM_MSG_SIZE + params.numParams() * NRPN_MSG_SIZE);
+        } else {
+            params.writeProgram(buf, SYSEX_PROGRAM_SIZE);
+            n = SYSEX_PROGRAM_SIZE;
+        }
+        if (!split) {
+            r.data.append(buf, n);
+        } else {
+            String name = r.file.getFileNameWithoutExtension() + String::formatted("_%03d", m.program) + (nrpn ? ".mid.raw" : ".syx");
+            File dest = out.getChildFile(name);
+            if (!dest.replaceWithData(buf, n)) {
+                r.text << dest.getFullPathName() << ": can't write\n";
+                r.failed = true;
+                return;
+            }
+        }
+        programs++;
+    }
+    r.text << r.file.getFullPathName() << ": " << programs << " programs converted\n";
+}
+
+static void json(FileResult &r, const IonSysexBank &bank, const MemoryBlock &data)
+{
+    const IonSysexSchema &schema = IonSysexSchema::get();
+    IonSysexParams params;
+
+    r.text << "  {\"file\": " << jsonString(r.file.getFullPathName()) << ", \"programs\": [";
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.program < 0) {
+            continue;
+        }
+        params.readProgramContent((const unsigned char *) data.getData() + m.offset + 1, SYSEX_CONTENT_SIZE);
+        r.text << ((m.program > 0) ? ",\n" : "\n") << "    {\"index\": " << m.program
+               << ", \"name\": " << jsonString(bank.getName(m.program)) << ", \"params\": [";
+
+        // what is stored in the program, less the fx parameters the selected fx don't use
+        bool first = true;
+        for (unsigned int k = 0; k < params.numParams(); k++) {
+            IonSysexParam *p = params.getParam(k);
+            if ((schema.fieldOfParam[k] < 0) || (p->getConversionType() == IonSysexParam::NAME) ||
+                params.shouldSkipFx1(p) || params.shouldSkipFx2(p)) {
+                continue;
+            }
+            r.text << (first ? "\n" : ",\n") << "      {\"name\": " << jsonString(p->getName());
+            if (p->hasNrpn()) {
+                r.text << ", \"nrpn\": " << p->getNrpn();
+            }
+            r.text << ", \"value\": " << p->getValue() << ", \"text\": " << jsonString(p->getValueText(p->getValue())) << "}";
+            first = false;
+        }
+        r.text << "\n    ]}";
+    }
+    r.text << "\n  ]}";
+}
+
+// the good programs as they are, with their hashes, for main() to dedup across files
+static void collect(FileResult &r, const IonSysexBank &bank, const MemoryBlock &data)
+{
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.program >= 0) {
+            r.data.append((const unsigned char *) data.getData() + m.offset, SYSEX_PROGRAM_SIZE);
+            r.hashes.push_back(bank.getHash(m.program));
+        }
+    }
+}
+
+static void processFile(FileResult &r, int parseThreads)
+{
+    MemoryBlock data;
+    IonSysexBank bank;
+
+    if (!r.file.loadFileAsData(data)) {
+        r.text << r.file.getFullPathName() << ": can't read\n";
+        r.failed = true;
+        return;
+    }
+    bank.parse(data.getData(), data.getSize(), parseThreads);
+    switch (command) {
+        case INSPECT:     inspect(r, bank); break;
+        case VALIDATE:    validate(r, bank); break;
+        case RECHECKSUM:  rechecksum(r, bank, data); break;
+        case CONVERT:     convert(r, bank, data); break;
+        case EXPORT_JSON: json(r, bank, data); break;
+        case DEDUP:       collect(r, bank, data); break;
+        case SCAN:
+        case PACK:
+        case UNPACK:
+        case QUERY:
+        case WATCH:       break;
+    }
+}
+
+class FileJob : public ThreadPoolJob
+{
+public:
+    FileJob(FileResult &r) : ThreadPoolJob("micronau-cli"), result(r) {
+    }
+    JobStatus runJob() {
+        processFile(result, 1);
+        return jobHasFinished;
+    }
+private:
+    FileResult &result;
+};
+
+class ScanProgress : public SyxScanner::Listener
+{
+public:
+    void scanProgress(int filesDone, int filesTotal, int programs) {
+        fprintf(stderr, "\r%d/%d files, %d programs", filesDone, filesTotal, programs);
+    }
+};
+
+static SyxScanner *scanner = nullptr;
+
+static void stopScan(int)
+{
+    scanner->cancel();
+}
+
+static int scan(const OwnedArray<FileResult> &results, SyxScanner &s)
+{
+    ScanProgress progress;
+    Array<File> files;
+    for (int i = 0; i < results.size(); i++) {
+        files.add(results[i]->file);
+    }
+
+    scanner = &s;
+    signal(SIGINT, stopScan);
+    int64 start = Time::getHighResolutionTicks();
+    bool done = s.scanFiles(files, threads, &progress);
+    double seconds = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start);
+    signal(SIGINT, SIG_DFL);
+    fprintf(stderr, "\n");
+
+    PatchHashIndex sounds;
+    for (int i = 0; i < s.numPrograms(); i++) {
+        sounds.add(s.getHash(i), i);
+    }
+    printf("%s%d files, %d programs, %d distinct sounds, %d errors, %d unreadable files in %.2f s\n",
+           done ? "" : "cancelled: ", s.numFiles(), s.numPrograms(), sounds.size(), s.numErrors(), s.numFileErrors(), seconds);
+    return (done && (s.numFileErrors() == 0)) ? 0 : 1;
+}
+
+static int unpack(const OwnedArray<FileResult> &results)
+{
+    MemoryBlock all;
+    for (int i = 0; i < results.size(); i++) {
+        PatchLibrary library;
+        if (!library.open(results[i]->file)) {
+            printf("%s: %s\n", results[i]->file.getFullPathName().toRawUTF8(), library.getError().toRawUTF8());
+            return 1;
+        }
+        for (int p = 0; p < library.numPatches(); p++) {
+            all.append(library.getProgram(p), SYSEX_PROGRAM_SIZE);
+        }
+    }
+    if (!out.replaceWithData(all.getData(), all.getSize())) {
+        printf("%s: can't write\n", out.getFullPathName().toRawUTF8());
+        return 1;
+    }
+    printf("%d programs written to %s\n", (int) (all.getSize() / SYSEX_PROGRAM_SIZE), out.getFullPathName().toRawUTF8());
+    return 0;
+}
+
+static int query(const OwnedArray<FileResult> &results)
+{
+    for (int i = 0; i < results.size(); i++) {
+        PatchLibrary library;
+        if (!library.open(results[i]->file)) {
+            printf("%s: %s\n", results[i]->file.getFullPathName().toRawUTF8(), library.getError().toRawUTF8());
+            return 1;
+        }
+        PatchQuery q(library);
+        int64 start = Time::getHighResolutionTicks();
+        bool parsed = q.run(queryText);
+        double ms = Time::highResolutionTicksToSeconds(Time::getHighResolutionTicks() - start) * 1000;
+        if (!parsed) {
+            printf("%s\n", q.getError().toRawUTF8());
+            return 2;
+        }
+        printf("%s: %d of %d patches in %.2f ms", results[i]->file.getFullPathName().toRawUTF8(), q.numMatches(), library.numPatches(), ms);
+        for (int c = 0; c < q.numClauses(); c++) {
+            printf("%s%d", (c == 0) ? " (" : ", ", q.getClauseCount(c));
+        }
+        printf("%s\n", q.numClauses() ? ")" : "");
+
+        Array<int> matches;
+        q.getMatches(matches);
+        for (int m = 0; m < matches.size(); m++) {
+            printf("%8d  %s\n", matches[m], library.getName(matches[m]).toRawUTF8());
+        }
+    }
+    return 0;
+}
+
+// prints and writes out from the watcher threads, one change at a time
+class WatchPrinter : public LibraryIndex::Listener {
+public:
+    WatchPrinter() : files(0), patches(0) {}
+    void libraryChanged(LibraryIndex &index) {
+        const ScopedLock sl(lock);
+        int nowFiles = index.numFiles(), nowPatches = index.numPatches();
+        printf("%d files (%+d), %d patches (%+d)\n", nowFiles, nowFiles - files, nowPatches, nowPatches - patches);
+        fflush(stdout);
+        files = nowFiles;
+        patches = nowPatches;
+        if ((out != File::nonexistent) && !index.write(out)) {
+            printf("%s: can't write\n", out.getFullPathName().toRawUTF8());
+        }
+    }
+private:
+    CriticalSection lock;
+    int files, patches;
+};
+
+// only a flag is set from the signal handler, the wait loop below polls it
+static volatile sig_atomic_t stopWatching = 0;
+
+static void stopWatch(int)
+{
+    stopWatching = 1;
+}
+
+static int watch(const OwnedArray<FileResult> &results)
+{
+    LibraryIndex index;
+    WatchPrinter printer;
+    OwnedArray<LibraryWatcher> watchers;
+
+    index.addListener(&printer);
+    signal(SIGINT, stopWatch);
+    for (int i = 0; i < results.size(); i++) {
+        if (!results[i]->file.isDirectory()) {
+            printf("%s: not a directory\n", results[i]->file.getFullPathName().toRawUTF8());
+            continue;
+        }
+        LibraryWatcher *w = watchers.add(new LibraryWatcher(index, results[i]->file));
+        w->startThread();
+    }
+    while ((watchers.size() > 0) && !stopWatching) {
+        Thread::sleep(100);
+    }
+    signal(SIGINT, SIG_DFL);
+    int watched = watchers.size();
+    watchers.clear();
+    index.removeListener(&printer);
+    return (watched == results.size()) ? 0 : 1;
+}
+
+static bool parseCommand(const char *name)
+{
+    static const char *names[] = { "inspect", "validate", "rechecksum", "convert", "json", "dedup", "scan", "pack", "unpack", "query", "watch" };
+    for (int i = 0; i < numElementsInArray(names); i++) {
+        if (strcmp(name, names[i]) == 0) {
+            command = (Command) i;
+            return true;
+        }
+    }
+    return false;
+}
+
+int main(int argc, char **argv)
+{
+    OwnedArray<FileResult> results;
+
+    if ((argc < 2) || !parseCommand(argv[1])) {
+        printf("%s", usage);
+        return 2;
+    }
+    File cwd = File::getCurrentWorkingDirectory();
+    for (int a = 2; a < argc; a++) {
+        if ((strcmp(argv[a], "-j") == 0) && (a + 1 < argc)) {
+            threads = atoi(argv[++a]);
+        } else if ((strcmp(argv[a], "-o") == 0) && (a + 1 < argc)) {
+            out = cwd.getChildFile(argv[++a]);
+        } else if ((strcmp(argv[a], "-c") == 0) && (a + 1 < argc)) {
+            channel = jlimit(1, 16, atoi(argv[++a])) - 1;
+        } else if ((strcmp(argv[a], "-q") == 0) && (a + 1 < argc)) {
+            queryText = String::fromUTF8(argv[++a]);
+        } else if (strcmp(argv[a], "--split") == 0) {
+            split = true;
+        } else if (strcmp(argv[a], "--nrpn") == 0) {
+            nrpn = true;
+        } else if (argv[a][0] == '-') {
+            printf("%s", usage);
+            return 2;
+        } else {
+            File f = cwd.getChildFile(argv[a]);
+            Array<File> found;
+            if (f.isDirectory() && (command == WATCH)) {
+                found.add(f);
+            } else if (f.isDirectory()) {
+                SyxScanner::findSyxFiles(f, (command == SCAN) || (command == PACK), found);
+            } else {
+                found.add(f);
+            }
+            for (int i = 0; i < found.size(); i++) {
+                FileResult *r = results.add(new FileResult());
+                r->file = found[i];
+                r->failed = false;
+            }
+        }
+    }
+    if ((results.size() == 0) || (((command == CONVERT) || (command == DEDUP) || (command == PACK) || (command == UNPACK)) && (out == File::nonexistent))) {
+        printf("%s", usage);
+        return 2;
+    }
+    if ((out != File::nonexistent) && (split || (command == RECHECKSUM)) && !out.createDirectory()) {
+        printf("%s: can't create directory\n", out.getFullPathName().toRawUTF8());
+        return 1;
+    }
+    if (threads <= 0) {
+        threads = SystemStats::getNumCpus();
+    }
+
+    if (command == SCAN) {
+        SyxScanner s;
+        return scan(results, s);
+    }
+    if (command == PACK) {
+        SyxScanner s;
+        PatchLibrary::Builder library;
+        int result = scan(results, s);
+        library.addScan(s);
+        if (!library.write(out)) {
+            printf("%s: can't write\n", out.getFullPathName().toRawUTF8());
+            return 1;
+        }
+        printf("%d patches written to %s\n", library.size(), out.getFullPathName().toRawUTF8());
+        return result;
+    }
+    if (command == UNPACK) {
+        return unpack(results);
+    }
+    if (command == QUERY) {
+        return query(results);
+    }
+    if (command == WATCH) {
+        return watch(results);
+    }
+
+    // a single file gets the threads for its decode, otherwise every file is a job
+    if ((results.size() == 1) || (threads == 1)) {
+        for (int i = 0; i < results.size(); i++) {
+            processFile(*results[i], threads);
+        }
+    } else {
+        ThreadPool pool(jmin(threads, results.size()));
+        OwnedArray<FileJob> jobs;
+        for (int i = 0; i < results.size(); i++) {
+            pool.addJob(jobs.add(new FileJob(*results[i])), false);
+        }
+        for (int i = 0; i < jobs.size(); i++) {
+            pool.waitForJobToFinish(jobs[i], -1);
+        }
+    }
+
+    int failed = 0;
+    int printed = 0;
+    if (command == EXPORT_JSON) {
+        printf("[\n");
+    }
+    for (int i = 0; i < results.size(); i++) {
+        FileResult &r = *results[i];
+        if ((command == EXPORT_JSON) && !r.failed) {
+            printf("%s%s", (printed++ > 0) ? ",\n" : "", r.text.toRawUTF8());
+        } else {
+            fprintf((command == EXPORT_JSON) ? stderr : stdout, "%s", r.text.toRawUTF8());
+        }
+        if (r.failed) {
+            failed++;
+        }
+    }
+    if (command == EXPORT_JSON) {
+        printf("\n]\n");
+    }
+    if ((command == CONVERT) && !split) {
+        MemoryBlock all;
+        for (int i = 0; i < results.size(); i++) {
+            all.append(results[i]->data.getData(), results[i]->data.getSize());
+        }
+        if (!out.replaceWithData(all.getData(), all.getSize())) {
+            printf("%s: can't write\n", out.getFullPathName().toRawUTF8());
+            failed++;
+        }
+    }
+    if (command == DEDUP) {
+        PatchHashIndex library;
+        MemoryBlock all;
+        int programs = 0;
+        for (int i = 0; i < results.size(); i++) {
+            FileResult &r = *results[i];
+            for (size_t k = 0; k < r.hashes.size(); k++) {
+                if (library.add(r.hashes[k], programs++) < 0) {
+                    all.append((const unsigned char *) r.data.getData() + k * SYSEX_PROGRAM_SIZE, SYSEX_PROGRAM_SIZE);
+                }
+            }
+        }
+        printf("%d programs, %d duplicates left out\n", programs, programs - library.size());
+        if (!out.replaceWithData(all.getData(), all.getSize())) {
+            printf("%s: can't write\n", out.getFullPathName().toRawUTF8());
+            failed++;
+        }
+    }
+    return failed ? 1 : 0;
+}
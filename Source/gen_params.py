@@ -0,0 +1,222 @@
+#!/usr/bin/env python3
+# Compiles parameters.xml and the remap tables in mapping.h into params_table.h,
+# so that IonSysexParams doesn't have to parse any xml at runtime.
+#
+# usage: python3 gen_params.py [source dir [output dir]]
+#
+# The Xcode project runs this before compiling. params_table.h is checked in, and the
+# CMake build stops when it differs from what this generates; run it by hand after
+# editing parameters.xml or mapping.h then.
+
+import os
+import re
+import sys
+
+# conversion names as understood by the old runtime xml loader, anything else is NONE
+CONVERSIONS = [
+    "NONE", "LIST", "PERCENT", "TENTHS_OF_PERCENT", "INT32", "INT16", "ENV_TIME",
+    "FX1_FX2_BALANCE", "FILTER_FREQ", "PITCH_FINE", "PORTA_TIME", "LFO_FREQ",
+    "FX_LFO_FREQ", "MS", "RELEASE_TIME", "FILTER_OFFSET_FREQ", "FILTER_OFFSET_OCT",
+    "BALANCE", "TENTHS", "NAME", "WET_DRY", "PRE_BAL", "POST_BAL", "BANK", "EXT_IN",
+    "OCTAVE", "SEMITONE", "TEXT_LABEL",
+]
+
+ENTITIES = {"amp": "&", "lt": "<", "gt": ">", "quot": "\"", "apos": "'"}
+
+# parameters.xml is not quite well formed (bare '&', unquoted numbers, no space
+# between some attributes), so it is tokenized by hand with the same leniency
+# tinyxml had.
+TAG = re.compile(r'<(/?)(\w+)((?:[^>"\']|"[^"]*"|\'[^\']*\')*?)(/?)>')
+ATTR = re.compile(r'(\w+)\s*=\s*(?:"([^"]*)"|\'([^\']*)\'|([^\s/>"\']+))')
+NUMBER = re.compile(r'\s*([-+]?\d+)')
+
+
+def fail(msg):
+    sys.stderr.write("gen_params.py: %s\n" % msg)
+    sys.exit(1)
+
+
+def unescape(s):
+    def repl(m):
+        ent = m.group(1)
+        if ent.startswith("#x"):
+            return chr(int(ent[2:], 16))
+        if ent.startswith("#"):
+            return chr(int(ent[1:]))
+        return ENTITIES.get(ent, m.group(0))
+    return re.sub(r'&(#x[0-9a-fA-F]+|#\d+|\w+);', repl, s)
+
+
+def attributes(text):
+    attrs = []
+    for m in ATTR.finditer(text):
+        value = m.group(2)
+        if value is None:
+            value = m.group(3)
+        if value is None:
+            value = m.group(4)
+        attrs.append((m.group(1), unescape(value)))
+    return attrs
+
+
+def to_int(name, value):
+    m = NUMBER.match(value)
+    if not m:
+        fail("bad %s value '%s'" % (name, value))
+    return int(m.group(1))
+
+
+def load_params(path):
+    text = open(path).read()
+    text = re.sub(r'<\?.*?\?>|<!--.*?-->', '', text, flags=re.S)
+    params = []
+    param = None
+    for m in TAG.finditer(text):
+        closing, tag, attrtext, empty = m.groups()
+        if closing:
+            if tag == "parameter":
+                param = None
+            continue
+        if tag == "parameters":
+            continue
+        attrs = attributes(attrtext)
+        if tag == "parameter":
+            if not attrs or attrs[0][0] != "name":
+                fail("first attribute of parameter element not name")
+            param = {"name": attrs[0][1], "paramname": None, "conv": "NONE",
+                     "min": 0, "max": 0, "offset": -1, "nrpn": -1,
+                     "defaultval": 0, "cntrloffset": 0, "items": []}
+            for name, value in attrs[1:]:
+                if name == "conversion":
+                    if value in CONVERSIONS:
+                        param["conv"] = value
+                elif name == "paramname":
+                    param["paramname"] = value
+                elif name == "sysexoffset":
+                    param["offset"] = to_int(name, value)
+                elif name in ("min", "max", "nrpn", "defaultval", "cntrloffset"):
+                    param[name] = to_int(name, value)
+            params.append(param)
+            if empty:
+                param = None
+        elif tag == "listitem":
+            if param is None:
+                fail("listitem outside of a parameter")
+            item = {"name": "", "enabled": True, "nrpn": None}
+            for name, value in attrs:
+                if name == "name":
+                    item["name"] = value
+                elif name == "disable":
+                    item["enabled"] = value != "true"
+                elif name == "nrpnvalue":
+                    item["nrpn"] = to_int(name, value)
+            param["items"].append(item)
+        else:
+            fail("unexpected element '%s'" % tag)
+    return params
+
+
+def load_remaps(path):
+    text = open(path).read()
+    remaps = []
+    for m in re.finditer(r'static\s+const\s+int\s+(\w+)_s_to_n\[\]\s*=\s*\{([^}]*)\}', text):
+        s_to_n = [int(v) for v in m.group(2).split(",") if v.strip()]
+        n_to_s = [0] * (max(s_to_n) + 1)
+        for s, n in enumerate(s_to_n):
+            n_to_s[n] = s
+        remaps.append((m.group(1), n_to_s))
+    if not remaps:
+        fail("no remap tables found in %s" % path)
+    return remaps
+
+
+def c_string(s):
+    if s is None:
+        return "NULL"
+    out = '"'
+    for ch in s:
+        if ch in '"\\':
+            out += "\\" + ch
+        elif 32 <= ord(ch) < 127:
+            out += ch
+        else:
+            out += '" "\\x%02x" "' % ord(ch)
+    return out + '"'
+
+
+def c_bool(b):
+    return "true" if b else "false"
+
+
+def int_rows(values, per_row=20):
+    rows = []
+    for i in range(0, len(values), per_row):
+        rows.append("    " + ",".join(str(v) for v in values[i:i + per_row]))
+    return ",\n".join(rows)
+
+
+def generate(params, remaps):
+    out = []
+    out.append("// generated by gen_params.py from parameters.xml and mapping.h - do not edit")
+    out.append("")
+    out.append("#ifndef PARAMS_TABLE_H")
+    out.append("#define PARAMS_TABLE_H")
+    out.append("")
+
+    out.append("static constexpr ListItemParameter paramListItems[] = {")
+    first = 0
+    for p in params:
+        if p["conv"] != "LIST":
+            p["items"] = []
+        p["first"] = first
+        first += len(p["items"])
+        for item in p["items"]:
+            nrpn = item["nrpn"]
+            out.append("    ListItemParameter(%s, %s, %s, %d)," % (
+                c_string(item["name"]), c_bool(item["enabled"]),
+                c_bool(nrpn is not None), nrpn or 0))
+    if first == 0:
+        out.append("    ListItemParameter(\"\", true, false, 0),")
+    out.append("};")
+    out.append("")
+
+    out.append("static constexpr IonSysexParamDesc paramTable[] = {")
+    out.append("    // name, paramname, conversion, min, max, sysexoffset, nrpn, defaultval, cntrloffset, first list item, list items")
+    for p in params:
+        items = len(p["items"])
+        out.append("    { %s, %s, IonSysexParam::%s, %d, %d, %d, %d, %d, %d, %d, %d }," % (
+            c_string(p["name"]), c_string(p["paramname"]), p["conv"], p["min"], p["max"],
+            p["offset"], p["nrpn"], p["defaultval"], p["cntrloffset"], p["first"], items))
+    out.append("};")
+    out.append("")
+    out.append("static constexpr int NUM_PARAMS = %d;" % len(params))
+    out.append("")
+
+    out.append("// nrpn -> sysex value, inverse of the tables in mapping.h")
+    for name, n_to_s in remaps:
+        out.append("static constexpr int %s_n_to_s[%d] = {" % (name, len(n_to_s)))
+        out.append(int_rows(n_to_s))
+        out.append("};")
+    out.append("")
+    out.append("#endif")
+    out.append("")
+    return "\n".join(out)
+
+
+def main():
+    src = sys.argv[1] if len(sys.argv) > 1 else os.path.dirname(os.path.abspath(__file__))
+    params = load_params(os.path.join(src, "parameters.xml"))
+    remaps = load_remaps(os.path.join(src, "mapping.h"))
+    text = generate(params, remaps)
+    out = sys.argv[2] if len(sys.argv) > 2 else src
+    path = os.path.join(out, "params_table.h")
+    # leave the file alone when nothing changed, so it doesn't trigger a rebuild
+    if os.path.exists(path) and open(path).read() == text:
+        return
+    f = open(path, "w")
+    f.write(text)
+    f.close()
+
+
+if __name__ == "__main__":
+    main()
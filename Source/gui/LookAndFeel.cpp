@@ -487,6 +487,11 @@ void PluginLookAndFeel::fillTextEditorBackground (Graphics& g, int width, int he
 	g.drawImageWithin(lcdPanel, 0, 0, width, height, RectanglePlacement(RectanglePlacement::stretchToFit));
 }
 
+void PluginLookAndFeel::drawLcdPanel (Graphics& g, int width, int height)
+{
+	g.drawImageWithin(lcdPanel, 0, 0, width, height, RectanglePlacement(RectanglePlacement::stretchToFit));
+}
+
 void PluginLookAndFeel::drawTextEditorOutline (Graphics& g, int width, int height, TextEditor& textEditor)
 {
 return;
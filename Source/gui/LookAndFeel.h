@@ -48,6 +48,9 @@ public:
 	void fillTextEditorBackground (Graphics& g, int width, int height, TextEditor& textEditor);
 	void drawTextEditorOutline (Graphics& g, int width, int height, TextEditor& textEditor);
 
+	// the lcd panel behind LcdLabels and LcdTextEditors, for components drawing their own
+	void drawLcdPanel (Graphics& g, int width, int height);
+
 private:
 	LookAndFeel stdLookAndFeel; // for falling back on the standard look and feel when needed.
 
@@ -0,0 +1,294 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+ 
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+ 
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#include "PatchBrowser.h"
+#include "LcdLabel.h"
+#include "LcdTextEditor.h"
+#include "LcdComboBox.h"
+#include "StdComboBox.h"
+#include "LookAndFeel.h"
+
+//==============================================================================
+PatchBrowser::PatchBrowser (MicronauAudioProcessor *ownerFilter)
+	: owner(ownerFilter), library(ownerFilter->get_library()), useCount(0),
+	  filterPending(false), backupRunning(false), restoring(false)
+{
+	categoryParam = owner->param_of_nrpn(666);
+	for (int i = 0; i < NUM_PAGES; i++)
+	{
+		pages[i].first = -1;
+		pages[i].lastUsed = 0;
+	}
+
+	filter = new LcdTextEditor();
+	filter->setTextToShowWhenEmpty("filter", Colours::black.withAlpha(0.4f));
+	filter->setTooltip("Part of a name, or a query like: env3 attack < 200 and mod LFO1 -> pitch");
+	filter->addListener(this);
+	addAndMakeVisible(filter);
+
+	// combo box ids are the category values + 2, 1 is any category
+	category = new LcdComboBox();
+	category->addItem("any category", 1);
+	const vector<ListItemParameter>& items = categoryParam->getList();
+	for (int i = 0; i < (int) items.size(); i++)
+		category->addItem(items[i].getName(), i + 2);
+	category->setSelectedId(1, dontSendNotification);
+	category->addListener(this);
+	addAndMakeVisible(category);
+
+	// in LibraryIndex::Order order
+	sort = new StdComboBox();
+	sort->addItem("by file", 1);
+	sort->addItem("by name", 2);
+	sort->addItem("by category", 3);
+	sort->setSelectedId(2, dontSendNotification);
+	sort->addListener(this);
+	addAndMakeVisible(sort);
+
+	folder = new TextButton("folder...");
+	folder->addListener(this);
+	addAndMakeVisible(folder);
+
+	backup = new TextButton("backup...");
+	backup->setTooltip("Save every slot of the micron to an archive");
+	backup->addListener(this);
+	addAndMakeVisible(backup);
+
+	restore = new TextButton("restore...");
+	restore->setTooltip("Put an archive back on the micron, writing only the slots that differ");
+	restore->addListener(this);
+	addAndMakeVisible(restore);
+
+	status = new LcdLabel("status");
+	status->setJustificationType(Justification::centredLeft);
+	status->setColour(Label::textColourId, Colours::black);
+	status->setFont(Font(12.00f, Font::plain));
+	addAndMakeVisible(status);
+
+	list = new ListBox("patches", this);
+	list->setRowHeight(ROW_H);
+	list->setColour(ListBox::backgroundColourId, Colour (0x00000000));
+	list->setColour(ListBox::outlineColourId, Colour (0x00000000));
+	addAndMakeVisible(list);
+
+	library.addListener(this);
+	reselect();
+}
+
+PatchBrowser::~PatchBrowser()
+{
+	library.removeListener(this);
+	cancelPendingUpdate();
+}
+
+void PatchBrowser::paint (Graphics& g)
+{
+	PluginLookAndFeel::getInstance()->drawLcdPanel(g, getWidth(), getHeight());
+}
+
+void PatchBrowser::resized()
+{
+	const int w = getWidth();
+	filter->setBounds(6, 6, 120, 15);
+	category->setBounds(132, 6, 110, 15);
+	sort->setBounds(248, 6, 90, 15);
+	backup->setBounds(w - 232, 5, 70, 17);
+	restore->setBounds(w - 154, 5, 70, 17);
+	folder->setBounds(w - 76, 5, 70, 17);
+	status->setBounds(344, 6, w - 582, 15);
+	list->setBounds(6, 28, w - 12, getHeight() - 34);
+}
+
+//==============================================================================
+int PatchBrowser::getNumRows()
+{
+	return (int) order.size();
+}
+
+// the page holding row, fetched over the least recently used one if it isn't there
+const LibraryIndex::Patch* PatchBrowser::getRow (int row)
+{
+	if ((row < 0) || (row >= (int) order.size()))
+		return nullptr;
+
+	const int first = row - row % PAGE_ROWS;
+	Page* page = &pages[0];
+	for (int i = 0; i < NUM_PAGES; i++)
+	{
+		if (pages[i].first == first)
+		{
+			page = &pages[i];
+			break;
+		}
+		if (pages[i].lastUsed < page->lastUsed)
+			page = &pages[i];
+	}
+	if (page->first != first)
+	{
+		page->first = first;
+		library.getPatches(&order[first], jmin((int) PAGE_ROWS, (int) order.size() - first), page->rows, page->found);
+	}
+	page->lastUsed = ++useCount;
+	return page->found[row - first] ? &page->rows[row - first] : nullptr;
+}
+
+void PatchBrowser::paintListBoxItem (int rowNumber, Graphics& g, int width, int height, bool rowIsSelected)
+{
+	const LibraryIndex::Patch* p = getRow(rowNumber);
+	if (p == nullptr)
+		return;
+
+	if (rowIsSelected)
+		g.fillAll(Colours::black.withAlpha(0.15f));
+
+	g.setColour(Colours::black);
+	g.setFont(Font(13.00f, Font::plain));
+	g.drawText(p->name, 4, 0, 130, height, Justification::centredLeft, true);
+	g.drawText(categoryParam->getConvertedValue(p->category), 140, 0, 110, height, Justification::centredLeft, true);
+	g.setColour(Colours::black.withAlpha(0.6f));
+	g.drawText(p->file.getRelativePathFrom(owner->get_library_dir()), 256, 0, width - 260, height, Justification::centredLeft, true);
+}
+
+void PatchBrowser::listBoxItemClicked (int row, const MouseEvent& e)
+{
+	audition(row);
+}
+
+void PatchBrowser::returnKeyPressed (int lastRowSelected)
+{
+	audition(lastRowSelected);
+}
+
+void PatchBrowser::audition (int row)
+{
+	if ((row >= 0) && (row < (int) order.size()))
+		owner->audition(order[row]);
+}
+
+//==============================================================================
+void PatchBrowser::libraryChanged (LibraryIndex& index)
+{
+	triggerAsyncUpdate();
+}
+
+void PatchBrowser::handleAsyncUpdate()
+{
+	reselect();
+}
+
+static String bothClauses (const String& a, const String& b)
+{
+	return (a.isEmpty() || b.isEmpty()) ? a + b : a + " and " + b;
+}
+
+// the rows in the order and with the filter that's chosen. the patches don't move,
+// only their numbers do, and the cached pages are dropped. the filter is run as a
+// PatchQuery, or as the part of a name if it isn't one.
+void PatchBrowser::reselect()
+{
+	const String text = filter->getText().trim();
+	const int cat = category->getSelectedId() - 2;
+	const String inCategory = (cat >= 0) ? "category = " + String(cat) : String::empty;
+	const LibraryIndex::Order by = (LibraryIndex::Order) jmax(0, sort->getSelectedId() - 1);
+	if (!library.select(bothClauses(text, inCategory), by, order))
+		library.select(bothClauses("name ~ " + text, inCategory), by, order);
+
+	for (int i = 0; i < NUM_PAGES; i++)
+	{
+		pages[i].first = -1;
+		pages[i].lastUsed = 0;
+	}
+	list->updateContent();
+	list->repaint();
+	updateStatus();
+}
+
+void PatchBrowser::updateStatus()
+{
+	if (owner->get_library_dir() == File::nonexistent)
+		status->setText("choose a folder of .syx files", dontSendNotification);
+	else
+		status->setText(String((int) order.size()) + " of " + String(library.numPatches()) + " patches", dontSendNotification);
+}
+
+void PatchBrowser::textEditorTextChanged (TextEditor& t)
+{
+	filterPending = true;
+	startTimer(FILTER_DELAY);
+}
+
+// applies the filter once typing stops, and follows a backup or restore while it runs
+void PatchBrowser::timerCallback()
+{
+	if (filterPending)
+	{
+		filterPending = false;
+		reselect();
+	}
+	if (backupRunning)
+		updateBackupStatus();
+	else
+		stopTimer();
+}
+
+void PatchBrowser::updateBackupStatus()
+{
+	HardwareBackup& b = owner->get_backup();
+	if (b.isBusy())
+	{
+		const char* what = (b.getPhase() == HardwareBackup::WRITING) ? "writing " : "reading ";
+		status->setText(what + String(b.getProgress()) + " of " + String(b.getTotal()) + " slots", dontSendNotification);
+		return;
+	}
+	backupRunning = false;
+	backup->setEnabled(true);
+	restore->setEnabled(true);
+	if (b.getError().isNotEmpty())
+		status->setText((restoring ? "restore failed: " : "backup failed: ") + b.getError(), dontSendNotification);
+	else if (restoring)
+		status->setText("restored, " + String(b.getWritten()) + " slots written", dontSendNotification);
+	else
+		status->setText("backup done", dontSendNotification);
+}
+
+void PatchBrowser::comboBoxChanged (ComboBox* box)
+{
+	reselect();
+}
+
+void PatchBrowser::buttonClicked (Button* button)
+{
+	if (button == folder)
+	{
+		FileChooser chooser("Library folder", owner->get_library_dir());
+		if (chooser.browseForDirectory())
+		{
+			owner->set_library_dir(chooser.getResult());
+			updateStatus();
+		}
+		return;
+	}
+
+	HardwareBackup& b = owner->get_backup();
+	FileChooser chooser(button == backup ? "Back up the micron to" : "Restore the micron from",
+						File::getSpecialLocation(File::userDocumentsDirectory), "*.mnbak");
+	bool started = false;
+	if ((button == backup) && chooser.browseForFileToSave(true))
+		started = b.startBackup(chooser.getResult().withFileExtension("mnbak"));
+	else if ((button == restore) && chooser.browseForFileToOpen())
+		started = b.startRestore(chooser.getResult());
+	if (started)
+	{
+		restoring = (button == restore);
+		backupRunning = true;
+		backup->setEnabled(false);
+		restore->setEnabled(false);
+		startTimer(250);
+	}
+}
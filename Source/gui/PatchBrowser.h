@@ -0,0 +1,106 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+ 
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+ 
+ Details can be found at: www.gnu.org/licenses
+*/
+
+#ifndef PATCHBROWSER_H_INCLUDED
+#define PATCHBROWSER_H_INCLUDED
+
+#include "../JuceLibraryCode/JuceHeader.h"
+#include "../micronau.h"
+
+class LcdLabel;
+class LcdTextEditor;
+class LcdComboBox;
+class StdComboBox;
+
+//==============================================================================
+/*
+	PatchBrowser:
+		Lists the patches of the plugin's library on an lcd panel. Only the rows
+		in view are painted, and they are fetched from the library a page at a
+		time into a fixed number of pages, so scrolling costs the same with a
+		hundred patches or a hundred thousand. Sorting and filtering only reorder
+		a list of patch numbers. Clicking a patch auditions it on the micron.
+		Whole units are backed up and restored from here too.
+*/
+class PatchBrowser : public Component,
+						public ListBoxModel,
+						public LibraryIndex::Listener,
+						public AsyncUpdater,
+						public TextEditorListener,
+						public ComboBoxListener,
+						public ButtonListener,
+						public Timer
+{
+public:
+	PatchBrowser (MicronauAudioProcessor *owner);
+	~PatchBrowser();
+
+	void paint (Graphics& g);
+	void resized();
+
+	int getNumRows();
+	void paintListBoxItem (int rowNumber, Graphics& g, int width, int height, bool rowIsSelected);
+	void listBoxItemClicked (int row, const MouseEvent& e);
+	void returnKeyPressed (int lastRowSelected);
+
+	void libraryChanged (LibraryIndex& index);	// from the watcher thread
+	void handleAsyncUpdate();
+
+	void textEditorTextChanged (TextEditor& t);
+	void comboBoxChanged (ComboBox* box);
+	void buttonClicked (Button* button);
+	void timerCallback();
+
+private:
+	enum
+	{
+		ROW_H = 16,
+		PAGE_ROWS = 64,
+		NUM_PAGES = 8,		// a few screens' worth
+		FILTER_DELAY = 150	// ms of no typing before the filter is applied
+	};
+
+	struct Page
+	{
+		int first;			// row, -1 if empty
+		uint32 lastUsed;
+		LibraryIndex::Patch rows[PAGE_ROWS];
+		bool found[PAGE_ROWS];
+	};
+
+	const LibraryIndex::Patch* getRow (int row);
+	void audition (int row);
+	void reselect();
+	void updateStatus();
+	void updateBackupStatus();
+
+	MicronauAudioProcessor *owner;
+	LibraryIndex& library;
+	IonSysexParam *categoryParam;
+
+	std::vector<int> order;	// patch numbers of the rows
+	Page pages[NUM_PAGES];
+	uint32 useCount;
+
+	ScopedPointer<ListBox> list;
+	ScopedPointer<LcdTextEditor> filter;
+	ScopedPointer<LcdComboBox> category;
+	ScopedPointer<StdComboBox> sort;
+	ScopedPointer<TextButton> folder;
+	ScopedPointer<TextButton> backup;
+	ScopedPointer<TextButton> restore;
+	ScopedPointer<LcdLabel> status;
+	bool filterPending;
+	bool backupRunning;
+	bool restoring;
+
+	JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (PatchBrowser)
+};
+
+#endif  // PATCHBROWSER_H_INCLUDED
@@ -27,25 +27,46 @@ TODO:
 
 #include "micronau.h"
 #include "micronauEditor.h"
+#include "NrpnEncoder.h"
+#include <algorithm>
+
+// reads the neighbours of the current program out of the library
+class MicronauAudioProcessor::PrefetchJob : public ThreadPoolJob
+{
+public:
+    PrefetchJob(MicronauAudioProcessor &p) : ThreadPoolJob("program prefetch"), plugin(p) {
+    }
+    JobStatus runJob() {
+        int center = plugin.prefetch_center.get();
+        for (int patch = center - 1; patch <= center + 1; patch++) {
+            plugin.prefetch(patch);
+        }
+        return (plugin.prefetch_center.get() == center) ? jobHasFinished : jobNeedsRunningAgain;
+    }
+private:
+    MicronauAudioProcessor &plugin;
+};
 
 //==============================================================================
 MicronauAudioProcessor::MicronauAudioProcessor()
 {
     params = new IonSysexParams();
     
-    int idx = 0;
     for (int i = 0; i < params->numParams(); i++) {
         IonSysexParam *param = params->getParam(i);
         if (param->hasNrpn()) {
+            host_index.add(nrpns.size());
             nrpns.add(param);
-            param_by_nrpn.set(param->getNrpn(), new ext_param(param, idx));
-            idx++;
+        } else {
+            host_index.add(-1);
         }
-
     }
 
+    transmit_queue = new TransmitQueue(*this, nrpns.size());
+
     midi_out = NULL;
     midi_out_port = "None";
+    nrpn_stream_time = 0;
     set_midi_port(MIDI_OUT_IDX, midi_out_port);
     set_midi_chan(0);
     
@@ -55,11 +76,28 @@ MicronauAudioProcessor::MicronauAudioProcessor()
 
     int sz;
     const char *x = BinaryData::getNamedResource("default_syx", sz);
-    init_from_sysex((unsigned char *) &x[1]);
+    init_from_sysex((const unsigned char *) &x[1], sz - 1);
+
+    current_program = 0;
+    for (int i = 0; i < 3; i++) {
+        prefetched[i].patch = -1;
+    }
+    prefetch_pool = new ThreadPool(1);
+    prefetch_job = new PrefetchJob(*this);
+    library.addListener(this);
+
+    hardware_backup = new HardwareBackup(*this);
 }
 
 MicronauAudioProcessor::~MicronauAudioProcessor()
 {
+    transmit_queue = nullptr;
+    hardware_backup = nullptr;
+    library_watcher = nullptr;
+    library.removeListener(this);
+    cancelPendingUpdate();
+    prefetch_pool = nullptr;
+
     if (midi_in != NULL) {
         midi_in->stop();
 		delete midi_in;
@@ -95,11 +133,12 @@ bool MicronauAudioProcessor::isMetaParameter (int parameterIndex) const
 	return nrpns[parameterIndex]->isTrackingGenValue() || parameterIndex == index_of_nrpn(631);
 }
 
+// hosts call this from any thread, the audio thread too, so the nrpns are left to the
+// transmit queue
 void MicronauAudioProcessor::setParameter (int index, float newValue)
 {
     IonSysexParam *param;
     param = nrpns[index];
-    int nrpn_num;
     int value = (int) newValue;
    
     // XXX - handle the tracking matrix
@@ -109,6 +148,20 @@ void MicronauAudioProcessor::setParameter (int index, float newValue)
 	
     param->setValue(value);
 
+    // sync_to_device() sends it with the rest
+    if (sync_held.get()) {
+        return;
+    }
+    transmit_queue->post(index, value);
+}
+
+int MicronauAudioProcessor::transmit(int index, int value)
+{
+    ScopedLock sending(midi_send_lock);
+    IonSysexParam *param = nrpns[index];
+    int nrpn_num;
+    int bytes = 0;
+
     // handle custom list values
     if (param->getList().size()) {
         ListItemParameter lip =  param->getList()[(int) value];
@@ -118,45 +171,46 @@ void MicronauAudioProcessor::setParameter (int index, float newValue)
     }
 
     if (param->isFxSelector()) {
-		// NOTE: must use value instead of newValue, as value has been remapped correctly for fx1 selector
-        send_nrpn(param->fxSelectorToNrpn()-512, value);
-
-        // we changed the fx type so update all the corresponding nrpns
-        int fxMinNrpn = param->fxMin();
-        int fxMaxNrpn = param->fxMax();
-        int fxnrpn;
-        for(fxnrpn = fxMinNrpn; fxnrpn < (fxMinNrpn+fxMaxNrpn); fxnrpn++) {
-            if (param_by_nrpn.contains(fxnrpn)) {
-                IonSysexParam *fxparam = param_by_nrpn[fxnrpn]->param;
-                nrpn_num = params->fx1fx2NrpnNum(fxparam)-512;
-                int fxvalue = fxparam->getNrpnValue();
-                send_nrpn(nrpn_num, fxvalue);
+        unsigned char buf[NRPN_MSG_SIZE * 11];
+
+        if (midi_out == NULL) {
+            return 0;
+        }
+        {
+            // the routing and the nrpn stream are shared with the syncs
+            ScopedLock lock(midi_port_lock);
+            begin_batch();
+            // NOTE: must use the remapped value, it is the one that's correct for the fx1 selector
+            bytes += encode_nrpn(param->fxSelectorToNrpn()-512, value, buf);
+            device_shadow.forgetFx(*params, param);
+
+            // we changed the fx type so update all the corresponding nrpns, in the same batch
+            int fxMinNrpn = param->fxMin();
+            int fxMaxNrpn = param->fxMax();
+            int fxnrpn;
+            for(fxnrpn = fxMinNrpn; fxnrpn < (fxMinNrpn+fxMaxNrpn); fxnrpn++) {
+                IonSysexParam *fxparam = params->getParamByNrpn(fxnrpn);
+                if (fxparam != NULL) {
+                    nrpn_num = params->wireNrpn(fxparam->getIndex());
+                    if (nrpn_num != NO_NRPN) {
+                        bytes += encode_nrpn(nrpn_num, fxparam->getNrpnValue(), buf + bytes);
+                    }
+                }
             }
         }
-        
-        return;
+        send_encoded(buf, bytes);
+        return bytes;
     }
 
     // "normal" parameter
-    nrpn_num = params->fx1fx2NrpnNum(param);
-    if (nrpn_num == NO_NRPN) {
-        return;
+    {
+        ScopedLock lock(midi_port_lock);
+        nrpn_num = params->wireNrpn(param->getIndex());
     }
-	if (params->shouldSkipFx1(param) || params->shouldSkipFx2(param)) {
-		return;
-	}
-	if (nrpn_num >= 2048) {
-		return;
-	}
-
-
-    if (nrpn_num >= 512) {
-        nrpn_num -= 512;
+    if (nrpn_num == NO_NRPN) {
+        return 0;
     }
-    send_nrpn(nrpn_num, (int) value);
-    
-    // update gui
-    // send nrpn
+    return send_nrpn(nrpn_num, (int) value);
 }
 
 const String MicronauAudioProcessor::getParameterName (int index)
@@ -166,7 +220,8 @@ const String MicronauAudioProcessor::getParameterName (int index)
 
 const String MicronauAudioProcessor::getParameterText (int index)
 {
-    return nrpns[index]->getTextValue();
+    IonSysexParam *param = nrpns[index];
+    return param->getValueText(param->getValue());
 }
 
 float MicronauAudioProcessor::getParameterMinValue (int index)
@@ -238,23 +293,39 @@ double MicronauAudioProcessor::getTailLengthSeconds() const
     return 0.0;
 }
 
+// the patches of the library, or just the one being edited while there's no library
 int MicronauAudioProcessor::getNumPrograms()
 {
-    return 0;
+    return jmax(1, library.numNumbers());
 }
 
 int MicronauAudioProcessor::getCurrentProgram()
 {
-    return 0;
+    return jlimit(0, getNumPrograms() - 1, current_program);
 }
 
 void MicronauAudioProcessor::setCurrentProgram (int index)
 {
+    unsigned char program[SYSEX_PROGRAM_SIZE];
+
+    if (!get_prefetched(index, program) && !library.getProgram(index, program)) {
+        return;
+    }
+    current_program = index;
+    init_from_sysex(program + 1, SYSEX_CONTENT_SIZE);
+    sync_to_device();
+    prefetch_around(index);
 }
 
+// names are only looked up when the host asks for them
 const String MicronauAudioProcessor::getProgramName (int index)
 {
-    return String::empty;
+    LibraryIndex::Patch p;
+
+    if (library.numPatches() == 0) {
+        return get_prog_name();
+    }
+    return library.getPatch(index, p) ? p.name : String::empty;
 }
 
 void MicronauAudioProcessor::changeProgramName (int index, const String& newName)
@@ -280,9 +351,27 @@ void MicronauAudioProcessor::processBlock (AudioSampleBuffer& buffer, MidiBuffer
 	{
 		ScopedLock lock(midi_port_lock);
 
-		// relay any incoming midi msgs from the host block out to our midi output
-		if (midi_out)
+		// relay any incoming midi msgs from the host block out to our midi output. juce's
+		// midi thread sends them at their time in the block, so the audio thread never
+		// waits on the device.
+		if (midi_out && !midiMessages.isEmpty())
+		{
 			midi_out->sendBlockOfMessages(midiMessages, Time::getMillisecondCounter(), sample_rate);
+			nrpn_stream.reset();	// may have selected some other nrpn
+
+			// and may have changed what the micron holds
+			MidiBuffer::Iterator it(midiMessages);
+			const uint8* data;
+			int size, pos;
+			while (it.getNextEvent(data, size, pos))
+			{
+				if ((data[0] == 0xf0) || ((data[0] & 0xf0) == 0xb0) || ((data[0] & 0xf0) == 0xc0))
+				{
+					device_shadow.forget();
+					break;
+				}
+			}
+		}
 	}
 
     // silence all output channels
@@ -306,128 +395,135 @@ AudioProcessorEditor* MicronauAudioProcessor::createEditor()
 //==============================================================================
 int MicronauAudioProcessor::index_of_nrpn(int nrpn) const
 {
-    return param_by_nrpn[nrpn]->index;
+    IonSysexParam *param = params->getParamByNrpn(nrpn);
+    return (param == NULL) ? -1 : host_index[param->getIndex()];
 }
 
 IonSysexParam *MicronauAudioProcessor::param_of_nrpn(int nrpn)
 {
-    return param_by_nrpn[nrpn]->param;
+    return params->getParamByNrpn(nrpn);
 }
 
 
-void MicronauAudioProcessor::sync_via_nrpn()
+// sends what the micron doesn't have yet, or everything when it may have been changed
+// from its own panel
+void MicronauAudioProcessor::sync_via_nrpn(bool everything)
 {
+	ScopedLock sending(midi_send_lock);
+    int n;
+
     if (midi_out == NULL) {
         return;
     }
-
-    send_bank_patch();
-    
-    int l = nrpns.size();
-    for (unsigned int i = 0; i < l; i++) {
-        IonSysexParam *param = nrpns[i];
-        int nrpn_num = params->fx1fx2NrpnNum(param);
-        if (params->shouldSkipFx1(param) || params->shouldSkipFx2(param)) {
-            continue;
-        }
-        if (nrpn_num >= 2048) {
-            continue;
-        }
-        /* XXX
-        if (nrpn_num < 300) {
-            if (nrpn_num == 100) {
-                sendMIDI(0xb0, 0, 0);
-                sendMIDI(0xb0, 32, get_bank_num());
-                continue;
-            }
-            if (nrpn_num == 101) {
-                sendMIDI(0xc0, get_patch_num(), 0);
-                continue;
-            }
-            continue;
-        }
-        */
-        if (nrpn_num >= 512) {
-            nrpn_num -= 512;
+    {
+        ScopedLock lock(midi_port_lock);
+        if (everything) {
+            device_shadow.forget();
         }
-        send_nrpn(nrpn_num, param->getNrpnValue(), false);
+        // bank/program change first, then the fx selectors, then the parameters that differ
+        n = device_shadow.encodeDiff(get_midi_chan(), *params, begin_batch());
     }
-    return;
+    send_encoded(device_shadow.getDiff(), n);
+}
+
+void MicronauAudioProcessor::hold_sync()
+{
+    sync_held = 1;
 }
 
-void MicronauAudioProcessor::send_bank_patch()
+// a program dump sets every parameter in one message, an nrpn diff only sends what
+// changed. whichever is done sooner wins, the diff is encoded once either way.
+void MicronauAudioProcessor::sync_to_device()
 {
+	ScopedLock sending(midi_send_lock);
+    int n;
+
+    sync_held = 0;
+    transmit_queue->discard();   // the sync has their latest values
     if (midi_out == NULL) {
         return;
     }
-    
-    unsigned char cmd = 0xb0 + get_midi_chan();
-    int bank, prog;
-    bank = param_of_nrpn(100)->getValue();
-    prog = param_of_nrpn(101)->getValue();
-    
-    MidiMessage *msg;
-    if (bank > 0) {
-        bank = bank - 1;
-
-        // bank msb
-        msg = new MidiMessage(cmd, 0, 0);
-        midi_out->sendMessageNow(*msg);
-        delete msg;
-        
-        // bank lsb
-        msg = new MidiMessage(cmd, 32, bank);
-        midi_out->sendMessageNow(*msg);
-        delete msg;
-    }
-
-    if (prog > 0) {
-        prog = prog - 1;
-        cmd = 0xc0 + get_midi_chan();
-        msg = new MidiMessage(cmd, prog);
-        midi_out->sendMessageNow(*msg);
-        delete msg;
-    }
-}
-
-void MicronauAudioProcessor::send_nrpn(int nrpn, int value, bool send_bank)
-{
-    unsigned char midiChannel = 176 + get_midi_chan();
-    unsigned char nrpnMSB;
-    unsigned char nrpnLSB;
-    unsigned char dataMSB;
-    unsigned char dataLSB;
-    MidiMessage *msg;
-    
+    {
+        ScopedLock lock(midi_port_lock);
+        n = device_shadow.encodeDiff(get_midi_chan(), *params, begin_batch());
+    }
+    if (DeviceShadow::prefersSysex(n)) {
+        sync_via_sysex();
+    } else {
+        send_encoded(device_shadow.getDiff(), n);
+    }
+}
+
+int MicronauAudioProcessor::send_bank_patch()
+{
+	ScopedLock sending(midi_send_lock);
+    unsigned char buf[BANK_PROGRAM_MSG_SIZE];
+    int n;
+
     if (midi_out == NULL) {
-        return;
+        return 0;
+    }
+    {
+        ScopedLock lock(midi_port_lock);
+        n = begin_batch().encodeBankProgram(get_midi_chan(), param_of_nrpn(100)->getValue(), param_of_nrpn(101)->getValue(), buf);
+        device_shadow.setBankProgram(param_of_nrpn(100)->getValue(), param_of_nrpn(101)->getValue());
+    }
+    send_encoded(buf, n);
+    return n;
+}
+
+// returns the bytes sent
+int MicronauAudioProcessor::send_nrpn(int nrpn, int value, bool send_bank)
+{
+	ScopedLock sending(midi_send_lock);
+    unsigned char buf[NRPN_MSG_SIZE];
+    int n;
+
+    if (midi_out == NULL) {
+        return 0;
     }
     
     if (send_bank && (nrpn >= 100) && (nrpn <= 101)) {
-        send_bank_patch();
-        return;
+        return send_bank_patch();
     }
-    
-    nrpnMSB = (nrpn >> 7) & (0x7f);
-    nrpnLSB = (nrpn & 0xff) & (0x7f);
-    dataMSB = (value >> 7) & (0x7f);
-    dataLSB = (value & 0xff) & (0x7f);
-    
-    msg = new MidiMessage(midiChannel, 0x63, nrpnMSB);
-    midi_out->sendMessageNow(*msg);
-    delete msg;
-    
-    msg = new MidiMessage(midiChannel, 0x62, nrpnLSB);
-    midi_out->sendMessageNow(*msg);
-    delete msg;
-    
-    msg = new MidiMessage(midiChannel, 0x6, dataMSB);
-    midi_out->sendMessageNow(*msg);
-    delete msg;
 
-    msg = new MidiMessage(midiChannel, 0x26, dataLSB);
-    midi_out->sendMessageNow(*msg);
-    delete msg;
+    {
+        ScopedLock lock(midi_port_lock);
+        begin_batch();
+        n = encode_nrpn(nrpn, value, buf);
+    }
+    send_encoded(buf, n);
+    return n;
+}
+
+// under midi_port_lock, the micron has it once buf is sent
+int MicronauAudioProcessor::encode_nrpn(int nrpn, int value, unsigned char *buf)
+{
+    device_shadow.set(nrpn, value);
+    return nrpn_stream.encodeNrpn(get_midi_chan(), nrpn, value, buf);
+}
+
+// under midi_port_lock, before the messages of a batch are encoded. the output doesn't
+// carry running status over from the last batch, so this one starts with a status byte.
+// the micron may also have been switched off and on, or been sent something else while
+// nothing went through the stream, so after a pause everything goes out whole again.
+NrpnStream &MicronauAudioProcessor::begin_batch()
+{
+    uint32 now = Time::getMillisecondCounter();
+    if (now - nrpn_stream_time > 1000) {
+        nrpn_stream.reset();
+    }
+    nrpn_stream.endBatch();
+    nrpn_stream_time = now;
+    return nrpn_stream;
+}
+
+// buf holds whole messages as written by NrpnEncoder, possibly in running status. they
+// go out as one batch, which the alsa output flushes to the device just once. under
+// midi_send_lock but not midi_port_lock, so processBlock() doesn't wait for the device.
+void MicronauAudioProcessor::send_encoded(const unsigned char *buf, int size)
+{
+    midi_out->sendMessagesNow(buf, size);
 }
 
 void MicronauAudioProcessor::setStateInformation (const void* data, int sizeInBytes)
@@ -435,7 +531,10 @@ void MicronauAudioProcessor::setStateInformation (const void* data, int sizeInBy
     preset *p = (preset *) data;
     String s;
 
-	if (!params->parseParamsFromContent(p->sysex, SYSEX_LEN)) {
+    if (sizeInBytes < (int) sizeof(preset)) {
+        return;
+    }
+	if (!params->readProgramContent(p->sysex, SYSEX_LEN)) {
 		return;
 	}
 
@@ -450,20 +549,29 @@ void MicronauAudioProcessor::setStateInformation (const void* data, int sizeInBy
     
     set_progchange(true);
 
+    // the library directory follows the preset, if it was saved with one, and then the
+    // numbers the host knows its patches by
+    const char *dir = (const char *) data + sizeof(preset);
+    const char *end = (const char *) data + sizeInBytes;
+    const char *dir_end = std::find(dir, end, 0);
+    if (dir_end != end) {
+        const char *numbers = dir_end + 1;
+        const char *numbers_end = std::find(numbers, end, 0);
+        set_library_dir(File(String::fromUTF8(dir, (int) (dir_end - dir))),
+                        (numbers_end != end) ? String::fromUTF8(numbers, (int) (numbers_end - numbers)) : String::empty);
+    }
+
     if ((p->bank != 0) && (p->patch != 0)) {
-        sync_via_nrpn();
+        sync_to_device();
     }
 }
 
 void MicronauAudioProcessor::getStateInformation (MemoryBlock& destData)
 {
-    unsigned char sysex_buf[SYSEX_LEN + 2];
     preset p;
     String s;
     
-    memset(sysex_buf, 0, SYSEX_LEN + 2);
-	params->getAsSysexMessage(sysex_buf);
-    memcpy(p.sysex, sysex_buf+1, SYSEX_LEN);
+	params->writeProgramContent(p.sysex, SYSEX_LEN);
 
     p.midi_out_chan = get_midi_chan();
     p.bank = param_of_nrpn(100)->getValue();
@@ -475,28 +583,36 @@ void MicronauAudioProcessor::getStateInformation (MemoryBlock& destData)
     s.copyToUTF8(((CharPointer_UTF8::CharType *) p.midi_out_port), MAX_MIDI_PORT_NAME);
 
     destData.append(&p, sizeof(p));
+
+    s = library_dir.getFullPathName();
+    destData.append(s.toRawUTF8(), s.getNumBytesAsUTF8() + 1);
+    s = library.saveNumbers(library_dir);
+    destData.append(s.toRawUTF8(), s.getNumBytesAsUTF8() + 1);
 }
 
 void MicronauAudioProcessor::sync_via_sysex()
 {
+	ScopedLock sending(midi_send_lock);
     unsigned char sysex_buf[SYSEX_LEN + 2];
 
     if (midi_out == NULL) {
         return;
     }
-    
-    memset(sysex_buf, 0, SYSEX_LEN + 2);
-	params->getAsSysexMessage(sysex_buf);
-
-    MidiMessage sysexe_msg(sysex_buf, sizeof(sysex_buf));
-    midi_out->sendMessageNow(sysexe_msg);
+    {
+        ScopedLock lock(midi_port_lock);
+        params->writeProgram(sysex_buf, sizeof(sysex_buf));
+        nrpn_stream.reset();
+        device_shadow.setProgram(*params);
+    }
+    send_encoded(sysex_buf, sizeof(sysex_buf));
 }
 
-void MicronauAudioProcessor::init_from_sysex(unsigned char *sysex)
+// false if it isn't a program the parameters could be read from
+bool MicronauAudioProcessor::init_from_sysex(const unsigned char *sysex, int size)
 {
 	int i;
-	if (!params->parseParamsFromContent(sysex, SYSEX_LEN)) {
-		return;
+	if (!params->readProgramContent(sysex, size)) {
+		return false;
 	}
 
 	for (i = 0; i < nrpns.size(); i++) {
@@ -505,6 +621,7 @@ void MicronauAudioProcessor::init_from_sysex(unsigned char *sysex)
         sendParamChangeMessageToListeners(i, param->getValue());
 	}
     set_progchange(true);
+    return true;
 }
     
 void MicronauAudioProcessor::handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message)
@@ -512,39 +629,76 @@ void MicronauAudioProcessor::handleIncomingMidiMessage (MidiInput* source, const
     if (source != midi_in) {
         return;
     }
-    if (message.isSysEx()) {
-        const uint8 *data = message.getSysExData();
-        init_from_sysex((unsigned char *) data);
+    if (message.isSysEx() && hardware_backup->isExpectingPrograms()) {
+        hardware_backup->programReceived(message.getRawData(), message.getRawDataSize());
+    } else if (message.isSysEx() && init_from_sysex(message.getSysExData(), message.getSysExDataSize())) {
+        // the micron sent it, so it holds all of it
+        ScopedLock lock(midi_port_lock);
+        device_shadow.setProgram(*params);
     }
 }
 
 void MicronauAudioProcessor::send_request()
 {
-    unsigned char req[]= {0x00, 0x00, 0x0e, 0x26, 0x41, 0x0, 0x0, 0x0};
     int bank, prog;
     bank = param_of_nrpn(100)->getValue();
     prog = param_of_nrpn(101)->getValue();
 
-    if (midi_out == NULL) {
-        return;
-    }
-    
     if ((bank == 0) || (prog == 0)) {
         return;
     }
-    bank--;
+    send_program_request(bank - 1, prog - 1);
+}
+
+// bank and prog from 0
+void MicronauAudioProcessor::send_program_request(int bank, int prog)
+{
+	ScopedLock sending(midi_send_lock);
+    unsigned char req[]= {0x00, 0x00, 0x0e, 0x26, 0x41, 0x0, 0x0, 0x0};
 
-    prog--;
+    if (midi_out == NULL) {
+        return;
+    }
 	req[5] = bank;
     req[6] = (prog >> 7) & 1;
     req[7] = prog & 0x7f;
     
     MidiMessage sysexe_msg = MidiMessage::createSysExMessage(req, sizeof(req));
+    {
+        ScopedLock lock(midi_port_lock);
+        nrpn_stream.reset();
+    }
     midi_out->sendMessageNow(sysexe_msg);
 }
 
+void MicronauAudioProcessor::requestProgram(int bank, int program)
+{
+    send_program_request(bank, program);
+}
+
+// selects the slot, then sends the dump the way the micron sent it for that slot
+void MicronauAudioProcessor::writeProgram(int bank, int program, const unsigned char *dump)
+{
+	ScopedLock sending(midi_send_lock);
+    unsigned char buf[BANK_PROGRAM_MSG_SIZE + SYSEX_PROGRAM_SIZE];
+    int n;
+
+    if (midi_out == NULL) {
+        return;
+    }
+    {
+        ScopedLock lock(midi_port_lock);
+        n = begin_batch().encodeBankProgram(get_midi_chan(), bank + 1, program + 1, buf);
+        nrpn_stream.reset();
+        device_shadow.forget();
+    }
+    memcpy(buf + n, dump, SYSEX_PROGRAM_SIZE);
+    send_encoded(buf, n + SYSEX_PROGRAM_SIZE);
+}
+
 void MicronauAudioProcessor::set_midi_port(int in_out, String p)
 {
+	ScopedLock sending(midi_send_lock);
 	ScopedLock lock(midi_port_lock);
 
     int idx;
@@ -557,6 +711,8 @@ void MicronauAudioProcessor::set_midi_port(int in_out, String p)
 					midi_out = NULL; // NOTE: must set the pointer to null due to a race-condition when setting output port to None. ProcessBlock() may attempt to use dangling midi_out pointer.
                 }
                 midi_out_port = p;
+                nrpn_stream.reset();
+                device_shadow.forget();
                 idx = midi_find_port_by_name(in_out, midi_out_port);
                 if (idx == -1) {
                     midi_out = NULL;
@@ -589,7 +745,9 @@ void MicronauAudioProcessor::set_midi_port(int in_out, String p)
 
 void MicronauAudioProcessor::set_midi_chan(unsigned int chan)
 {
+	ScopedLock lock(midi_port_lock);
     midi_out_channel = chan;
+    device_shadow.forget();
 }
 
 unsigned int MicronauAudioProcessor::get_midi_chan()
@@ -610,6 +768,76 @@ String MicronauAudioProcessor::get_midi_port(int in_out)
     return "None";
 }
 
+void MicronauAudioProcessor::set_library_dir(const File &dir, const String &numbers)
+{
+    if ((dir == library_dir) && numbers.isEmpty()) {
+        return;
+    }
+    library_watcher = nullptr;
+    library.restoreNumbers(numbers, dir);
+    library_dir = dir;
+    if (library_dir.isDirectory()) {
+        library_watcher = new LibraryWatcher(library, library_dir);
+        library_watcher->startThread(3);
+    }
+}
+
+void MicronauAudioProcessor::audition(int patch)
+{
+    setCurrentProgram(patch);
+    updateHostDisplay();
+}
+
+bool MicronauAudioProcessor::get_prefetched(int patch, unsigned char *program)
+{
+    const ScopedLock sl(prefetch_lock);
+    const prefetched_program &p = prefetched[(patch % 3 + 3) % 3];
+    if ((p.patch != patch) || (p.version != library.getVersion())) {
+        return false;
+    }
+    memcpy(program, p.sysex, SYSEX_PROGRAM_SIZE);
+    return true;
+}
+
+void MicronauAudioProcessor::prefetch_around(int patch)
+{
+    prefetch_center = patch;
+    if (!prefetch_pool->contains(prefetch_job)) {
+        prefetch_pool->addJob(prefetch_job, false);
+    }
+}
+
+// on the prefetch thread
+void MicronauAudioProcessor::prefetch(int patch)
+{
+    unsigned char program[SYSEX_PROGRAM_SIZE];
+
+    if ((patch < 0) || get_prefetched(patch, program)) {
+        return;
+    }
+    uint32 version = library.getVersion();
+    if (!library.getProgram(patch, program)) {
+        return;
+    }
+    const ScopedLock sl(prefetch_lock);
+    prefetched_program &p = prefetched[patch % 3];
+    p.patch = patch;
+    p.version = version;
+    memcpy(p.sysex, program, SYSEX_PROGRAM_SIZE);
+}
+
+void MicronauAudioProcessor::libraryChanged (LibraryIndex& index)
+{
+    triggerAsyncUpdate();
+}
+
+// the patches may have moved, tell the host and read ahead again
+void MicronauAudioProcessor::handleAsyncUpdate()
+{
+    updateHostDisplay();
+    prefetch_around(current_program);
+}
+
 String MicronauAudioProcessor::get_prog_name()
 {
     return params->get_prog_name();
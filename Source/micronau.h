@@ -12,24 +12,22 @@
 
 #include "../JuceLibraryCode/JuceHeader.h"
 #include "IonSysex.h"
+#include "LibraryWatcher.h"
+#include "HardwareBackup.h"
+#include "TransmitQueue.h"
 
 #define MIDI_OUT_IDX 0
 #define MIDI_IN_IDX 1
 
-//==============================================================================
-class ext_param {
-public:
-    ext_param(IonSysexParam *p, int idx) : param(p), index(idx) {
-    }
-    IonSysexParam *param;
-    int index;
-};
-
 //==============================================================================
 /**
 */
 class MicronauAudioProcessor  : public AudioProcessor,
-                                public MidiInputCallback
+                                public MidiInputCallback,
+                                public LibraryIndex::Listener,
+                                public AsyncUpdater,
+                                public HardwareBackup::Device,
+                                public TransmitQueue::Target
 {
 public:
     //==============================================================================
@@ -86,11 +84,20 @@ public:
 
     //==============================================================================
     void handleIncomingMidiMessage (MidiInput* source, const MidiMessage& message);
+
+    void libraryChanged (LibraryIndex& index);
+    void handleAsyncUpdate();
    
     //==============================================================================
     // micronau specific from here on down
-    void sync_via_nrpn();
+    void sync_via_nrpn(bool everything = false);
     void sync_via_sysex();
+
+    // makes the micron hold the current parameters the quickest way, by nrpn difference
+    // or by program dump. between hold_sync() and sync_to_device() parameter changes
+    // aren't sent one by one.
+    void sync_to_device();
+    void hold_sync();
     void send_request();
  
     String get_midi_port(int in_out);
@@ -106,6 +113,20 @@ public:
     void set_progchange(bool v) {prog_changed = v;}
     
     static int midi_find_port_by_name(int idx, String nm);
+
+    // the .syx files under the library directory, kept current while the plugin runs
+    LibraryIndex &get_library() {return library;}
+    File get_library_dir() {return library_dir;}
+    void set_library_dir(const File &dir, const String &numbers = String::empty);   // from saveNumbers()
+    void audition(int patch);   // loads a library patch and sends it to the micron
+
+    // every slot of the micron to or from an archive, on the backup's thread
+    HardwareBackup &get_backup() {return *hardware_backup;}
+    void requestProgram(int bank, int program);
+    void writeProgram(int bank, int program, const unsigned char *dump);
+
+    // a host parameter's latest value, on the transmit queue's thread
+    int transmit(int index, int value);
 private:
     //==============================================================================
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR (MicronauAudioProcessor)
@@ -120,13 +141,20 @@ private:
         unsigned int bank;
         unsigned int patch;
     } preset;
-    void send_nrpn(int nrpn, int value, bool send_bank=true);
-    void init_from_sysex(unsigned char *sysex);
-    void send_bank_patch();
+    int send_nrpn(int nrpn, int value, bool send_bank=true);
+    bool init_from_sysex(const unsigned char *sysex, int size);
+    int send_bank_patch();
+    void send_program_request(int bank, int prog);
+    void send_encoded(const unsigned char *buf, int size);
+    int encode_nrpn(int nrpn, int value, unsigned char *buf);
+    NrpnStream &begin_batch();
+    bool get_prefetched(int patch, unsigned char *program);
+    void prefetch_around(int patch);
+    void prefetch(int patch);
 
     IonSysexParams *params;
-    Array<IonSysexParam*> nrpns;
-    HashMap<int, ext_param *> param_by_nrpn;
+    Array<IonSysexParam*> nrpns;  // host parameter index -> param
+    Array<int> host_index;        // param index -> host parameter index, -1 if not exposed
 
 	double sample_rate; // used for midi thru timing
 
@@ -134,9 +162,38 @@ private:
     unsigned int midi_out_channel;
     String midi_out_port;
     CriticalSection midi_port_lock; // use this to ensure midi port is not halfway changed when process block runs
+    CriticalSection midi_send_lock; // taken before midi_port_lock, held while sending so batches keep their order
+                                    // and midi_out stays open. midi_port_lock is only held to encode them.
+    NrpnStream nrpn_stream;         // what the micron was last sent, under midi_port_lock
+    uint32 nrpn_stream_time;        // of the last message through it
+    DeviceShadow device_shadow;     // what the micron holds, under midi_port_lock. its diff is sent under midi_send_lock
+    Atomic<int> sync_held;
+    ScopedPointer<TransmitQueue> transmit_queue;   // of host parameter changes
 
     MidiInput *midi_in;
     String midi_in_port;
     bool prog_changed;
+
+    LibraryIndex library;
+    ScopedPointer<LibraryWatcher> library_watcher;   // goes before library does
+    File library_dir;
+
+    // the host's programs are the library's patches. the current one and its
+    // neighbours are read ahead, so that stepping through them doesn't wait on the
+    // library while it's being sorted or updated.
+    class PrefetchJob;
+    typedef struct {
+        int patch;               // -1 if empty
+        uint32 version;          // of the library it was read at
+        unsigned char sysex[SYSEX_PROGRAM_SIZE];
+    } prefetched_program;
+    prefetched_program prefetched[3];   // patch % 3
+    CriticalSection prefetch_lock;
+    ScopedPointer<ThreadPool> prefetch_pool;
+    ScopedPointer<PrefetchJob> prefetch_job;
+    Atomic<int> prefetch_center;
+    int current_program;
+
+    ScopedPointer<HardwareBackup> hardware_backup;
 };
 #endif  // __PLUGINPROCESSOR_H_CCAD67E2__
@@ -77,6 +77,9 @@ MicronauAudioProcessorEditor::MicronauAudioProcessorEditor (MicronauAudioProcess
 	add_label("redo", LOGO_X + 34, LOGO_Y + 78, 35, 15);
     redo_button = create_guibutton(LOGO_X + 34, LOGO_Y + 65);
 
+	add_label("library", LOGO_X + 9, LOGO_Y + 110, 50, 15);
+    library_button = create_guibutton(LOGO_X + 16, LOGO_Y + 97);
+
 	param_display = new LcdLabel("panel", "micronAU\nretroware");
     param_display->setJustificationType (Justification::centredLeft);
     param_display->setEditable (false, false, false);
@@ -119,6 +122,10 @@ MicronauAudioProcessorEditor::MicronauAudioProcessorEditor (MicronauAudioProcess
 
     logo = Drawable::createFromImageData (BinaryData::logo_svg, BinaryData::logo_svgSize);
 
+    browser = new PatchBrowser(owner);
+    browser->setBounds(BROWSER_X, BROWSER_Y, BROWSER_W, BROWSER_H);
+    addChildComponent(browser);
+
 	// whole gui size
     setSize (1060, 670);
 
@@ -873,7 +880,7 @@ void MicronauAudioProcessorEditor::buttonClicked (Button* button)
 		lcdTextMessage = b->get_name() + "\n" + b->get_txt_value(v);
 	}
 	else if (button == sync_nrpn) {
-        owner->sync_via_nrpn();
+        owner->sync_via_nrpn(true);
 		lcdTextMessage = "Sync prgm nrpn\nDone";
     }
     else if (button == sync_sysex) {
@@ -883,6 +890,11 @@ void MicronauAudioProcessorEditor::buttonClicked (Button* button)
     else if (button == request) {
         owner->send_request();
 		lcdTextMessage = "Send prgm request\nDone";
+    }
+    else if (button == library_button) {
+        browser->setVisible(!browser->isVisible());
+        browser->toFront(false);
+		lcdTextMessage = browser->isVisible() ? "Library\nOpen" : "Library\nClosed";
     }
 	else if (button == randomizeButton)
 	{
@@ -938,6 +950,7 @@ ext_combo* MicronauAudioProcessorEditor::findBoxWithNrpn(int nrpn)
 void MicronauAudioProcessorEditor::randomizeParams()
 {
 	allowNewSnapshots = false; // don't generate undo steps for each param modified
+	owner->hold_sync(); // and send the result to the micron in one go
 
 	bool lockPitch = randomizeLockPitchButton->getToggleState();
 
@@ -1130,6 +1143,7 @@ void MicronauAudioProcessorEditor::randomizeParams()
 		}
 	}
 
+	owner->sync_to_device();
 	allowNewSnapshots = true;
 	takeUndoSnapshot();
 }
@@ -1184,6 +1198,7 @@ void MicronauAudioProcessorEditor::restorePreviousUndoSnapshot(bool redo)
 	Snapshot& snapshot = *undo_cur;
 	
 	allowNewSnapshots = false; // don't generate more snapshots while restoring current one
+	owner->hold_sync();
 
 	owner->set_prog_name(snapshot.progname_value); // ensure name text box doesn't get clobbered with old data..
 	prog_name->setText(snapshot.progname_value, true); // .. as the text box change notification is async.
@@ -1194,6 +1209,7 @@ void MicronauAudioProcessorEditor::restorePreviousUndoSnapshot(bool redo)
 	for (int i = 0; i < buttons.size(); i++)
 		buttons[i]->setToggleState(snapshot.button_values[i], sendNotificationSync);
 	
+	owner->sync_to_device();
 	allowNewSnapshots = true;
 }
 
@@ -17,6 +17,7 @@
 #include "gui/MicronToggleButton.h"
 #include "gui/MicronTabBar.h"
 #include "gui/SliderBank.h"
+#include "gui/PatchBrowser.h"
 #include <vector>
 #include <list>
 
@@ -80,7 +81,7 @@ public:
     int get_nrpn() {return nrpn;}
     const String get_name () { return param->getName();}
     const String get_txt_value (int v) { return param->getConvertedValue(v);}
-    vector<ListItemParameter> & get_list_item_names() {return param->getList();}
+    const vector<ListItemParameter> & get_list_item_names() {return param->getList();}
 	const IonSysexParam* getInternalParam() { return param; }
 
 private:
@@ -253,7 +254,13 @@ private:
         FX_X = ENVS_X,
         FX_Y = ENVS_Y + 245,
         FX_W = 440,
-        FX_H = 105
+        FX_H = 105,
+
+		// the patch browser covers the synth sections while it's open
+		BROWSER_X = LEFT_X,
+		BROWSER_Y = OSCS_Y,
+		BROWSER_W = 865,
+		BROWSER_H = 515
 	};
 
     void add_knob(int nrpn, int x, int y, const char *text, Component *parent);
@@ -308,6 +315,8 @@ private:
     ScopedPointer<Button> request;
     ScopedPointer<Button> undo_button;
     ScopedPointer<Button> redo_button;
+    ScopedPointer<Button> library_button;
+    ScopedPointer<PatchBrowser> browser;
 
     ScopedPointer<ComboBox> midi_in_menu;
     ScopedPointer<ComboBox> midi_out_menu;
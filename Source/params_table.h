@@ -0,0 +1,3975 @@
+// generated by gen_params.py from parameters.xml and mapping.h - do not edit
+
+#ifndef PARAMS_TABLE_H
+#define PARAMS_TABLE_H
+
+static constexpr ListItemParameter paramListItems[] = {
+    ListItemParameter("1", true, false, 0),
+    ListItemParameter("2", true, false, 0),
+    ListItemParameter("3", true, false, 0),
+    ListItemParameter("4", true, false, 0),
+    ListItemParameter("5", true, false, 0),
+    ListItemParameter("6", true, false, 0),
+    ListItemParameter("7", true, false, 0),
+    ListItemParameter("8", true, false, 0),
+    ListItemParameter("9", true, false, 0),
+    ListItemParameter("10", true, false, 0),
+    ListItemParameter("11", true, false, 0),
+    ListItemParameter("12", true, false, 0),
+    ListItemParameter("13", true, false, 0),
+    ListItemParameter("14", true, false, 0),
+    ListItemParameter("15", true, false, 0),
+    ListItemParameter("16", true, false, 0),
+    ListItemParameter("Front", true, false, 0),
+    ListItemParameter("Rear", true, false, 0),
+    ListItemParameter("Dual 1", true, false, 0),
+    ListItemParameter("Dual 2", true, false, 0),
+    ListItemParameter("Randomizer", true, false, 0),
+    ListItemParameter("About", true, false, 0),
+    ListItemParameter("Settings", true, false, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("fx1", true, false, 0),
+    ListItemParameter("fx2", true, false, 0),
+    ListItemParameter("xyz", true, false, 0),
+    ListItemParameter("s&h", true, false, 0),
+    ListItemParameter("Polyphony", true, false, 0),
+    ListItemParameter("Unison", true, false, 0),
+    ListItemParameter("Unison Detune", true, false, 0),
+    ListItemParameter("Porta", true, false, 0),
+    ListItemParameter("PortaType", true, false, 0),
+    ListItemParameter("PortaTime", true, false, 0),
+    ListItemParameter("Pitch Wheel", true, false, 0),
+    ListItemParameter("Analog drift", true, false, 0),
+    ListItemParameter("Osc Sync", true, false, 0),
+    ListItemParameter("FM Amount", true, false, 0),
+    ListItemParameter("FM Type", true, false, 0),
+    ListItemParameter("O1 wave", true, false, 0),
+    ListItemParameter("O1 shape", true, false, 0),
+    ListItemParameter("O1 octave", true, false, 0),
+    ListItemParameter("O1 transpose", true, false, 0),
+    ListItemParameter("O1 pitch", true, false, 0),
+    ListItemParameter("O1 PWheel", true, false, 0),
+    ListItemParameter("O2 wave", true, false, 0),
+    ListItemParameter("O2 shape", true, false, 0),
+    ListItemParameter("O2 octave", true, false, 0),
+    ListItemParameter("O2 transpose", true, false, 0),
+    ListItemParameter("O2 pitch", true, false, 0),
+    ListItemParameter("O2 PWheel", true, false, 0),
+    ListItemParameter("O3 wave", true, false, 0),
+    ListItemParameter("O3 shape", true, false, 0),
+    ListItemParameter("O3 octave", true, false, 0),
+    ListItemParameter("O3 transpose", true, false, 0),
+    ListItemParameter("O3 pitch", true, false, 0),
+    ListItemParameter("O3 PWheel", true, false, 0),
+    ListItemParameter("O1 level", true, false, 0),
+    ListItemParameter("O2 level", true, false, 0),
+    ListItemParameter("O3 level", true, false, 0),
+    ListItemParameter("Ring level", true, false, 0),
+    ListItemParameter("Noise level", true, false, 0),
+    ListItemParameter("ExtIn level", true, false, 0),
+    ListItemParameter("O1 bal", true, false, 0),
+    ListItemParameter("O2 bal", true, false, 0),
+    ListItemParameter("O3 bal", true, false, 0),
+    ListItemParameter("Ring bal", true, false, 0),
+    ListItemParameter("Noise bal", true, false, 0),
+    ListItemParameter("ExtIn bal", true, false, 0),
+    ListItemParameter("Series level", true, false, 0),
+    ListItemParameter("Noise type", true, false, 0),
+    ListItemParameter("F1 type", true, false, 0),
+    ListItemParameter("F1 freq", true, false, 0),
+    ListItemParameter("F1 res", true, false, 0),
+    ListItemParameter("F1 keytrk", true, false, 0),
+    ListItemParameter("F1 env amt", true, false, 0),
+    ListItemParameter("F2 offset", true, false, 0),
+    ListItemParameter("F2 type", true, false, 0),
+    ListItemParameter("F2 freq", true, false, 0),
+    ListItemParameter("F2 res", true, false, 0),
+    ListItemParameter("F2 keytrk", true, false, 0),
+    ListItemParameter("F2 env amt", true, false, 0),
+    ListItemParameter("F1 level", true, false, 0),
+    ListItemParameter("F2 level", true, false, 0),
+    ListItemParameter("Preflt level", true, false, 0),
+    ListItemParameter("F1 pan", true, false, 0),
+    ListItemParameter("F2 pan", true, false, 0),
+    ListItemParameter("Preflt pan", true, false, 0),
+    ListItemParameter("Preflt src", true, false, 0),
+    ListItemParameter("F1 sign", true, false, 0),
+    ListItemParameter("Drive type", true, false, 0),
+    ListItemParameter("Drive level", true, false, 0),
+    ListItemParameter("Prog level", true, false, 0),
+    ListItemParameter("Fx mix", true, false, 0),
+    ListItemParameter("E1 atk time", true, false, 0),
+    ListItemParameter("E1 atk slope", true, false, 0),
+    ListItemParameter("E1 dec time", true, false, 0),
+    ListItemParameter("E1 dec slope", true, false, 0),
+    ListItemParameter("E1 sus time", true, false, 0),
+    ListItemParameter("E1 sus level", true, false, 0),
+    ListItemParameter("E1 rel time", true, false, 0),
+    ListItemParameter("E1 rel slope", true, false, 0),
+    ListItemParameter("E1 velocity", true, false, 0),
+    ListItemParameter("E1 reset", true, false, 0),
+    ListItemParameter("E1 freerun", true, false, 0),
+    ListItemParameter("E1 loop", true, false, 0),
+    ListItemParameter("E1 pedal", true, false, 0),
+    ListItemParameter("E2 atk time", true, false, 0),
+    ListItemParameter("E2 atk slope", true, false, 0),
+    ListItemParameter("E2 dec time", true, false, 0),
+    ListItemParameter("E2 dec slope", true, false, 0),
+    ListItemParameter("E2 sus time", true, false, 0),
+    ListItemParameter("E2 sus level", true, false, 0),
+    ListItemParameter("E2 rel time", true, false, 0),
+    ListItemParameter("E2 rel slope", true, false, 0),
+    ListItemParameter("E2 velocity", true, false, 0),
+    ListItemParameter("E2 reset", true, false, 0),
+    ListItemParameter("E2 freerun", true, false, 0),
+    ListItemParameter("E2 loop", true, false, 0),
+    ListItemParameter("E2 pedal", true, false, 0),
+    ListItemParameter("E3 atk time", true, false, 0),
+    ListItemParameter("E3 atk slope", true, false, 0),
+    ListItemParameter("E3 dec time", true, false, 0),
+    ListItemParameter("E3 dec slope", true, false, 0),
+    ListItemParameter("E3 Sus time", true, false, 0),
+    ListItemParameter("E3 Sus level", true, false, 0),
+    ListItemParameter("E3 rel time", true, false, 0),
+    ListItemParameter("E3 rel slope", true, false, 0),
+    ListItemParameter("E3 velocity", true, false, 0),
+    ListItemParameter("E3 reset", true, false, 0),
+    ListItemParameter("E3 freerun", true, false, 0),
+    ListItemParameter("E3 loop", true, false, 0),
+    ListItemParameter("E3 pedal", true, false, 0),
+    ListItemParameter("Lfo1 sync", true, false, 0),
+    ListItemParameter("Lfo1 rate", true, false, 0),
+    ListItemParameter("Lfo1 reset", true, false, 0),
+    ListItemParameter("Lfo1 M1 slider", true, false, 0),
+    ListItemParameter("Lfo2 sync", true, false, 0),
+    ListItemParameter("Lfo2 rate", true, false, 0),
+    ListItemParameter("Lfo2 reset", true, false, 0),
+    ListItemParameter("Lfo2 M1 slider", true, false, 0),
+    ListItemParameter("S/H sync", true, false, 0),
+    ListItemParameter("S/H rate", true, false, 0),
+    ListItemParameter("S/H reset", true, false, 0),
+    ListItemParameter("S/H input", true, false, 0),
+    ListItemParameter("S/H smoothing", true, false, 0),
+    ListItemParameter("Tracking", true, false, 0),
+    ListItemParameter("Trk preset", true, false, 0),
+    ListItemParameter("Track Grid", true, false, 0),
+    ListItemParameter("Trk x=-16", true, false, 0),
+    ListItemParameter("Trk x=-15", true, false, 0),
+    ListItemParameter("Trk x=-14", true, false, 0),
+    ListItemParameter("Trk x=-13", true, false, 0),
+    ListItemParameter("Trk x=-12", true, false, 0),
+    ListItemParameter("Trk x=-11", true, false, 0),
+    ListItemParameter("Trk x=-10", true, false, 0),
+    ListItemParameter("Trk x=-9", true, false, 0),
+    ListItemParameter("Trk x=-8", true, false, 0),
+    ListItemParameter("Trk x=-7", true, false, 0),
+    ListItemParameter("Trk x=-6", true, false, 0),
+    ListItemParameter("Trk x=-5", true, false, 0),
+    ListItemParameter("Trk x=-4", true, false, 0),
+    ListItemParameter("Trk x=-3", true, false, 0),
+    ListItemParameter("Trk x=-2", true, false, 0),
+    ListItemParameter("Trk x=-1", true, false, 0),
+    ListItemParameter("Trk x=0", true, false, 0),
+    ListItemParameter("Trk x=1", true, false, 0),
+    ListItemParameter("Trk x=2", true, false, 0),
+    ListItemParameter("Trk x=3", true, false, 0),
+    ListItemParameter("Trk x=4", true, false, 0),
+    ListItemParameter("Trk x=5", true, false, 0),
+    ListItemParameter("Trk x=6", true, false, 0),
+    ListItemParameter("Trk x=7", true, false, 0),
+    ListItemParameter("Trk x=8", true, false, 0),
+    ListItemParameter("Trk x=9", true, false, 0),
+    ListItemParameter("Trk x=10", true, false, 0),
+    ListItemParameter("Trk x=11", true, false, 0),
+    ListItemParameter("Trk x=12", true, false, 0),
+    ListItemParameter("Trk x=13", true, false, 0),
+    ListItemParameter("Trk x=14", true, false, 0),
+    ListItemParameter("Trk x=15", true, false, 0),
+    ListItemParameter("Trk x=16", true, false, 0),
+    ListItemParameter("Category", true, false, 0),
+    ListItemParameter("Knob X param", true, false, 0),
+    ListItemParameter("Knob Y param", true, false, 0),
+    ListItemParameter("Knob Z param", true, false, 0),
+    ListItemParameter("F2 freq Offset", true, false, 0),
+    ListItemParameter("Lfo1 rate sync", true, false, 0),
+    ListItemParameter("Lfo2 rate sync", true, false, 0),
+    ListItemParameter("S/H rate sync", true, false, 0),
+    ListItemParameter("Polyphony", true, false, 0),
+    ListItemParameter("Unison", true, false, 0),
+    ListItemParameter("Unison Detune", true, false, 0),
+    ListItemParameter("Porta", true, false, 0),
+    ListItemParameter("PortaType", true, false, 0),
+    ListItemParameter("PortaTime", true, false, 0),
+    ListItemParameter("Pitch Wheel", true, false, 0),
+    ListItemParameter("Analog drift", true, false, 0),
+    ListItemParameter("Osc Sync", true, false, 0),
+    ListItemParameter("FM Amount", true, false, 0),
+    ListItemParameter("FM Type", true, false, 0),
+    ListItemParameter("O1 wave", true, false, 0),
+    ListItemParameter("O1 shape", true, false, 0),
+    ListItemParameter("O1 octave", true, false, 0),
+    ListItemParameter("O1 transpose", true, false, 0),
+    ListItemParameter("O1 pitch", true, false, 0),
+    ListItemParameter("O1 PWheel", true, false, 0),
+    ListItemParameter("O2 wave", true, false, 0),
+    ListItemParameter("O2 shape", true, false, 0),
+    ListItemParameter("O2 octave", true, false, 0),
+    ListItemParameter("O2 transpose", true, false, 0),
+    ListItemParameter("O2 pitch", true, false, 0),
+    ListItemParameter("O2 PWheel", true, false, 0),
+    ListItemParameter("O3 wave", true, false, 0),
+    ListItemParameter("O3 shape", true, false, 0),
+    ListItemParameter("O3 octave", true, false, 0),
+    ListItemParameter("O3 transpose", true, false, 0),
+    ListItemParameter("O3 pitch", true, false, 0),
+    ListItemParameter("O3 PWheel", true, false, 0),
+    ListItemParameter("O1 level", true, false, 0),
+    ListItemParameter("O2 level", true, false, 0),
+    ListItemParameter("O3 level", true, false, 0),
+    ListItemParameter("Ring level", true, false, 0),
+    ListItemParameter("Noise level", true, false, 0),
+    ListItemParameter("ExtIn level", true, false, 0),
+    ListItemParameter("O1 bal", true, false, 0),
+    ListItemParameter("O2 bal", true, false, 0),
+    ListItemParameter("O3 bal", true, false, 0),
+    ListItemParameter("Ring bal", true, false, 0),
+    ListItemParameter("Noise bal", true, false, 0),
+    ListItemParameter("ExtIn bal", true, false, 0),
+    ListItemParameter("Series level", true, false, 0),
+    ListItemParameter("Noise type", true, false, 0),
+    ListItemParameter("F1 type", true, false, 0),
+    ListItemParameter("F1 freq", true, false, 0),
+    ListItemParameter("F1 res", true, false, 0),
+    ListItemParameter("F1 keytrk", true, false, 0),
+    ListItemParameter("F1 env amt", true, false, 0),
+    ListItemParameter("F2 offset", true, false, 0),
+    ListItemParameter("F2 type", true, false, 0),
+    ListItemParameter("F2 freq", true, false, 0),
+    ListItemParameter("F2 res", true, false, 0),
+    ListItemParameter("F2 keytrk", true, false, 0),
+    ListItemParameter("F2 env amt", true, false, 0),
+    ListItemParameter("F1 level", true, false, 0),
+    ListItemParameter("F2 level", true, false, 0),
+    ListItemParameter("Preflt level", true, false, 0),
+    ListItemParameter("F1 pan", true, false, 0),
+    ListItemParameter("F2 pan", true, false, 0),
+    ListItemParameter("Preflt pan", true, false, 0),
+    ListItemParameter("Preflt src", true, false, 0),
+    ListItemParameter("F1 sign", true, false, 0),
+    ListItemParameter("Drive type", true, false, 0),
+    ListItemParameter("Drive level", true, false, 0),
+    ListItemParameter("Prog level", true, false, 0),
+    ListItemParameter("Fx mix", true, false, 0),
+    ListItemParameter("E1 atk time", true, false, 0),
+    ListItemParameter("E1 atk slope", true, false, 0),
+    ListItemParameter("E1 dec time", true, false, 0),
+    ListItemParameter("E1 dec slope", true, false, 0),
+    ListItemParameter("E1 sus time", true, false, 0),
+    ListItemParameter("E1 sus level", true, false, 0),
+    ListItemParameter("E1 rel time", true, false, 0),
+    ListItemParameter("E1 rel slope", true, false, 0),
+    ListItemParameter("E1 velocity", true, false, 0),
+    ListItemParameter("E1 reset", true, false, 0),
+    ListItemParameter("E1 freerun", true, false, 0),
+    ListItemParameter("E1 loop", true, false, 0),
+    ListItemParameter("E1 pedal", true, false, 0),
+    ListItemParameter("E2 atk time", true, false, 0),
+    ListItemParameter("E2 atk slope", true, false, 0),
+    ListItemParameter("E2 dec time", true, false, 0),
+    ListItemParameter("E2 dec slope", true, false, 0),
+    ListItemParameter("E2 sus time", true, false, 0),
+    ListItemParameter("E2 sus level", true, false, 0),
+    ListItemParameter("E2 rel time", true, false, 0),
+    ListItemParameter("E2 rel slope", true, false, 0),
+    ListItemParameter("E2 velocity", true, false, 0),
+    ListItemParameter("E2 reset", true, false, 0),
+    ListItemParameter("E2 freerun", true, false, 0),
+    ListItemParameter("E2 loop", true, false, 0),
+    ListItemParameter("E2 pedal", true, false, 0),
+    ListItemParameter("E3 atk time", true, false, 0),
+    ListItemParameter("E3 atk slope", true, false, 0),
+    ListItemParameter("E3 dec time", true, false, 0),
+    ListItemParameter("E3 dec slope", true, false, 0),
+    ListItemParameter("E3 Sus time", true, false, 0),
+    ListItemParameter("E3 Sus level", true, false, 0),
+    ListItemParameter("E3 rel time", true, false, 0),
+    ListItemParameter("E3 rel slope", true, false, 0),
+    ListItemParameter("E3 velocity", true, false, 0),
+    ListItemParameter("E3 reset", true, false, 0),
+    ListItemParameter("E3 freerun", true, false, 0),
+    ListItemParameter("E3 loop", true, false, 0),
+    ListItemParameter("E3 pedal", true, false, 0),
+    ListItemParameter("Lfo1 sync", true, false, 0),
+    ListItemParameter("Lfo1 rate", true, false, 0),
+    ListItemParameter("Lfo1 reset", true, false, 0),
+    ListItemParameter("Lfo1 M1 slider", true, false, 0),
+    ListItemParameter("Lfo2 sync", true, false, 0),
+    ListItemParameter("Lfo2 rate", true, false, 0),
+    ListItemParameter("Lfo2 reset", true, false, 0),
+    ListItemParameter("Lfo2 M1 slider", true, false, 0),
+    ListItemParameter("S/H sync", true, false, 0),
+    ListItemParameter("S/H rate", true, false, 0),
+    ListItemParameter("S/H reset", true, false, 0),
+    ListItemParameter("S/H input", true, false, 0),
+    ListItemParameter("S/H smoothing", true, false, 0),
+    ListItemParameter("Tracking", true, false, 0),
+    ListItemParameter("Trk preset", true, false, 0),
+    ListItemParameter("Track Grid", true, false, 0),
+    ListItemParameter("Trk x=-16", true, false, 0),
+    ListItemParameter("Trk x=-15", true, false, 0),
+    ListItemParameter("Trk x=-14", true, false, 0),
+    ListItemParameter("Trk x=-13", true, false, 0),
+    ListItemParameter("Trk x=-12", true, false, 0),
+    ListItemParameter("Trk x=-11", true, false, 0),
+    ListItemParameter("Trk x=-10", true, false, 0),
+    ListItemParameter("Trk x=-9", true, false, 0),
+    ListItemParameter("Trk x=-8", true, false, 0),
+    ListItemParameter("Trk x=-7", true, false, 0),
+    ListItemParameter("Trk x=-6", true, false, 0),
+    ListItemParameter("Trk x=-5", true, false, 0),
+    ListItemParameter("Trk x=-4", true, false, 0),
+    ListItemParameter("Trk x=-3", true, false, 0),
+    ListItemParameter("Trk x=-2", true, false, 0),
+    ListItemParameter("Trk x=-1", true, false, 0),
+    ListItemParameter("Trk x=0", true, false, 0),
+    ListItemParameter("Trk x=1", true, false, 0),
+    ListItemParameter("Trk x=2", true, false, 0),
+    ListItemParameter("Trk x=3", true, false, 0),
+    ListItemParameter("Trk x=4", true, false, 0),
+    ListItemParameter("Trk x=5", true, false, 0),
+    ListItemParameter("Trk x=6", true, false, 0),
+    ListItemParameter("Trk x=7", true, false, 0),
+    ListItemParameter("Trk x=8", true, false, 0),
+    ListItemParameter("Trk x=9", true, false, 0),
+    ListItemParameter("Trk x=10", true, false, 0),
+    ListItemParameter("Trk x=11", true, false, 0),
+    ListItemParameter("Trk x=12", true, false, 0),
+    ListItemParameter("Trk x=13", true, false, 0),
+    ListItemParameter("Trk x=14", true, false, 0),
+    ListItemParameter("Trk x=15", true, false, 0),
+    ListItemParameter("Trk x=16", true, false, 0),
+    ListItemParameter("Category", true, false, 0),
+    ListItemParameter("Knob X param", true, false, 0),
+    ListItemParameter("Knob Y param", true, false, 0),
+    ListItemParameter("Knob Z param", true, false, 0),
+    ListItemParameter("F2 freq Offset", true, false, 0),
+    ListItemParameter("Lfo1 rate sync", true, false, 0),
+    ListItemParameter("Lfo2 rate sync", true, false, 0),
+    ListItemParameter("S/H rate sync", true, false, 0),
+    ListItemParameter("Polyphony", true, false, 0),
+    ListItemParameter("Unison", true, false, 0),
+    ListItemParameter("Unison Detune", true, false, 0),
+    ListItemParameter("Porta", true, false, 0),
+    ListItemParameter("PortaType", true, false, 0),
+    ListItemParameter("PortaTime", true, false, 0),
+    ListItemParameter("Pitch Wheel", true, false, 0),
+    ListItemParameter("Analog drift", true, false, 0),
+    ListItemParameter("Osc Sync", true, false, 0),
+    ListItemParameter("FM Amount", true, false, 0),
+    ListItemParameter("FM Type", true, false, 0),
+    ListItemParameter("O1 wave", true, false, 0),
+    ListItemParameter("O1 shape", true, false, 0),
+    ListItemParameter("O1 octave", true, false, 0),
+    ListItemParameter("O1 transpose", true, false, 0),
+    ListItemParameter("O1 pitch", true, false, 0),
+    ListItemParameter("O1 PWheel", true, false, 0),
+    ListItemParameter("O2 wave", true, false, 0),
+    ListItemParameter("O2 shape", true, false, 0),
+    ListItemParameter("O2 octave", true, false, 0),
+    ListItemParameter("O2 transpose", true, false, 0),
+    ListItemParameter("O2 pitch", true, false, 0),
+    ListItemParameter("O2 PWheel", true, false, 0),
+    ListItemParameter("O3 wave", true, false, 0),
+    ListItemParameter("O3 shape", true, false, 0),
+    ListItemParameter("O3 octave", true, false, 0),
+    ListItemParameter("O3 transpose", true, false, 0),
+    ListItemParameter("O3 pitch", true, false, 0),
+    ListItemParameter("O3 PWheel", true, false, 0),
+    ListItemParameter("O1 level", true, false, 0),
+    ListItemParameter("O2 level", true, false, 0),
+    ListItemParameter("O3 level", true, false, 0),
+    ListItemParameter("Ring level", true, false, 0),
+    ListItemParameter("Noise level", true, false, 0),
+    ListItemParameter("ExtIn level", true, false, 0),
+    ListItemParameter("O1 bal", true, false, 0),
+    ListItemParameter("O2 bal", true, false, 0),
+    ListItemParameter("O3 bal", true, false, 0),
+    ListItemParameter("Ring bal", true, false, 0),
+    ListItemParameter("Noise bal", true, false, 0),
+    ListItemParameter("ExtIn bal", true, false, 0),
+    ListItemParameter("Series level", true, false, 0),
+    ListItemParameter("Noise type", true, false, 0),
+    ListItemParameter("F1 type", true, false, 0),
+    ListItemParameter("F1 freq", true, false, 0),
+    ListItemParameter("F1 res", true, false, 0),
+    ListItemParameter("F1 keytrk", true, false, 0),
+    ListItemParameter("F1 env amt", true, false, 0),
+    ListItemParameter("F2 offset", true, false, 0),
+    ListItemParameter("F2 type", true, false, 0),
+    ListItemParameter("F2 freq", true, false, 0),
+    ListItemParameter("F2 res", true, false, 0),
+    ListItemParameter("F2 keytrk", true, false, 0),
+    ListItemParameter("F2 env amt", true, false, 0),
+    ListItemParameter("F1 level", true, false, 0),
+    ListItemParameter("F2 level", true, false, 0),
+    ListItemParameter("Preflt level", true, false, 0),
+    ListItemParameter("F1 pan", true, false, 0),
+    ListItemParameter("F2 pan", true, false, 0),
+    ListItemParameter("Preflt pan", true, false, 0),
+    ListItemParameter("Preflt src", true, false, 0),
+    ListItemParameter("F1 sign", true, false, 0),
+    ListItemParameter("Drive type", true, false, 0),
+    ListItemParameter("Drive level", true, false, 0),
+    ListItemParameter("Prog level", true, false, 0),
+    ListItemParameter("Fx mix", true, false, 0),
+    ListItemParameter("E1 atk time", true, false, 0),
+    ListItemParameter("E1 atk slope", true, false, 0),
+    ListItemParameter("E1 dec time", true, false, 0),
+    ListItemParameter("E1 dec slope", true, false, 0),
+    ListItemParameter("E1 sus time", true, false, 0),
+    ListItemParameter("E1 sus level", true, false, 0),
+    ListItemParameter("E1 rel time", true, false, 0),
+    ListItemParameter("E1 rel slope", true, false, 0),
+    ListItemParameter("E1 velocity", true, false, 0),
+    ListItemParameter("E1 reset", true, false, 0),
+    ListItemParameter("E1 freerun", true, false, 0),
+    ListItemParameter("E1 loop", true, false, 0),
+    ListItemParameter("E1 pedal", true, false, 0),
+    ListItemParameter("E2 atk time", true, false, 0),
+    ListItemParameter("E2 atk slope", true, false, 0),
+    ListItemParameter("E2 dec time", true, false, 0),
+    ListItemParameter("E2 dec slope", true, false, 0),
+    ListItemParameter("E2 sus time", true, false, 0),
+    ListItemParameter("E2 sus level", true, false, 0),
+    ListItemParameter("E2 rel time", true, false, 0),
+    ListItemParameter("E2 rel slope", true, false, 0),
+    ListItemParameter("E2 velocity", true, false, 0),
+    ListItemParameter("E2 reset", true, false, 0),
+    ListItemParameter("E2 freerun", true, false, 0),
+    ListItemParameter("E2 loop", true, false, 0),
+    ListItemParameter("E2 pedal", true, false, 0),
+    ListItemParameter("E3 atk time", true, false, 0),
+    ListItemParameter("E3 atk slope", true, false, 0),
+    ListItemParameter("E3 dec time", true, false, 0),
+    ListItemParameter("E3 dec slope", true, false, 0),
+    ListItemParameter("E3 Sus time", true, false, 0),
+    ListItemParameter("E3 Sus level", true, false, 0),
+    ListItemParameter("E3 rel time", true, false, 0),
+    ListItemParameter("E3 rel slope", true, false, 0),
+    ListItemParameter("E3 velocity", true, false, 0),
+    ListItemParameter("E3 reset", true, false, 0),
+    ListItemParameter("E3 freerun", true, false, 0),
+    ListItemParameter("E3 loop", true, false, 0),
+    ListItemParameter("E3 pedal", true, false, 0),
+    ListItemParameter("Lfo1 sync", true, false, 0),
+    ListItemParameter("Lfo1 rate", true, false, 0),
+    ListItemParameter("Lfo1 reset", true, false, 0),
+    ListItemParameter("Lfo1 M1 slider", true, false, 0),
+    ListItemParameter("Lfo2 sync", true, false, 0),
+    ListItemParameter("Lfo2 rate", true, false, 0),
+    ListItemParameter("Lfo2 reset", true, false, 0),
+    ListItemParameter("Lfo2 M1 slider", true, false, 0),
+    ListItemParameter("S/H sync", true, false, 0),
+    ListItemParameter("S/H rate", true, false, 0),
+    ListItemParameter("S/H reset", true, false, 0),
+    ListItemParameter("S/H input", true, false, 0),
+    ListItemParameter("S/H smoothing", true, false, 0),
+    ListItemParameter("Tracking", true, false, 0),
+    ListItemParameter("Trk preset", true, false, 0),
+    ListItemParameter("Track Grid", true, false, 0),
+    ListItemParameter("Trk x=-16", true, false, 0),
+    ListItemParameter("Trk x=-15", true, false, 0),
+    ListItemParameter("Trk x=-14", true, false, 0),
+    ListItemParameter("Trk x=-13", true, false, 0),
+    ListItemParameter("Trk x=-12", true, false, 0),
+    ListItemParameter("Trk x=-11", true, false, 0),
+    ListItemParameter("Trk x=-10", true, false, 0),
+    ListItemParameter("Trk x=-9", true, false, 0),
+    ListItemParameter("Trk x=-8", true, false, 0),
+    ListItemParameter("Trk x=-7", true, false, 0),
+    ListItemParameter("Trk x=-6", true, false, 0),
+    ListItemParameter("Trk x=-5", true, false, 0),
+    ListItemParameter("Trk x=-4", true, false, 0),
+    ListItemParameter("Trk x=-3", true, false, 0),
+    ListItemParameter("Trk x=-2", true, false, 0),
+    ListItemParameter("Trk x=-1", true, false, 0),
+    ListItemParameter("Trk x=0", true, false, 0),
+    ListItemParameter("Trk x=1", true, false, 0),
+    ListItemParameter("Trk x=2", true, false, 0),
+    ListItemParameter("Trk x=3", true, false, 0),
+    ListItemParameter("Trk x=4", true, false, 0),
+    ListItemParameter("Trk x=5", true, false, 0),
+    ListItemParameter("Trk x=6", true, false, 0),
+    ListItemParameter("Trk x=7", true, false, 0),
+    ListItemParameter("Trk x=8", true, false, 0),
+    ListItemParameter("Trk x=9", true, false, 0),
+    ListItemParameter("Trk x=10", true, false, 0),
+    ListItemParameter("Trk x=11", true, false, 0),
+    ListItemParameter("Trk x=12", true, false, 0),
+    ListItemParameter("Trk x=13", true, false, 0),
+    ListItemParameter("Trk x=14", true, false, 0),
+    ListItemParameter("Trk x=15", true, false, 0),
+    ListItemParameter("Trk x=16", true, false, 0),
+    ListItemParameter("Category", true, false, 0),
+    ListItemParameter("Knob X param", true, false, 0),
+    ListItemParameter("Knob Y param", true, false, 0),
+    ListItemParameter("Knob Z param", true, false, 0),
+    ListItemParameter("F2 freq Offset", true, false, 0),
+    ListItemParameter("Lfo1 rate sync", true, false, 0),
+    ListItemParameter("Lfo2 rate sync", true, false, 0),
+    ListItemParameter("S/H rate sync", true, false, 0),
+    ListItemParameter("recent", true, false, 0),
+    ListItemParameter("faves", true, false, 0),
+    ListItemParameter("bass", true, false, 0),
+    ListItemParameter("lead", true, false, 0),
+    ListItemParameter("pad", true, false, 0),
+    ListItemParameter("string", true, false, 0),
+    ListItemParameter("brass", true, false, 0),
+    ListItemParameter("key", true, false, 0),
+    ListItemParameter("comp", true, false, 0),
+    ListItemParameter("drum", true, false, 0),
+    ListItemParameter("sfx", true, false, 0),
+    ListItemParameter("mono", true, false, 0),
+    ListItemParameter("poly", true, false, 0),
+    ListItemParameter("1", true, true, 0),
+    ListItemParameter("2", true, true, 1),
+    ListItemParameter("4", true, true, 2),
+    ListItemParameter("8", true, true, 3),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("always", true, true, 2),
+    ListItemParameter("legato", true, true, 1),
+    ListItemParameter("fixed", true, false, 0),
+    ListItemParameter("scaled", true, false, 0),
+    ListItemParameter("gliss fixed", true, false, 0),
+    ListItemParameter("gliss scaled", true, false, 0),
+    ListItemParameter("all", true, true, 1),
+    ListItemParameter("held", true, true, 0),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("hard 2 -> 1", true, true, 1),
+    ListItemParameter("hard 2+3 -> 1", true, true, 2),
+    ListItemParameter("soft 2 -> 1", true, true, 3),
+    ListItemParameter("soft 2+3 -> 1", true, true, 4),
+    ListItemParameter("lin 3 > 2 > 1", true, true, 2),
+    ListItemParameter("lin 2+3 > 1", true, true, 1),
+    ListItemParameter("lin 2 > 1", true, true, 0),
+    ListItemParameter("exp 3 > 2 > 1", true, true, 5),
+    ListItemParameter("exp 2+3 > 1", true, true, 4),
+    ListItemParameter("exp 2 > 1", true, true, 3),
+    ListItemParameter("sine", true, false, 0),
+    ListItemParameter("tri/saw", true, false, 0),
+    ListItemParameter("pulse", true, false, 0),
+    ListItemParameter("-3 octaves", true, true, -3),
+    ListItemParameter("-2 octaves ", true, true, -2),
+    ListItemParameter("-1 octave", true, true, -1),
+    ListItemParameter("0 octaves", true, true, 0),
+    ListItemParameter("1 octave", true, true, 1),
+    ListItemParameter("2 octaves", true, true, 2),
+    ListItemParameter("3 octaves", true, true, 3),
+    ListItemParameter("-7 semitones", true, true, -7),
+    ListItemParameter("-6 semitones", true, true, -6),
+    ListItemParameter("-5 semitones", true, true, -5),
+    ListItemParameter("-4 semitones", true, true, -4),
+    ListItemParameter("-3 semitones", true, true, -3),
+    ListItemParameter("-2 semitones", true, true, -2),
+    ListItemParameter("-1 semitone", true, true, -1),
+    ListItemParameter("0 semitones", true, true, 0),
+    ListItemParameter("1 semitones", true, true, 1),
+    ListItemParameter("2 semitones", true, true, 2),
+    ListItemParameter("3 semitones", true, true, 3),
+    ListItemParameter("4 semitones", true, true, 4),
+    ListItemParameter("5 semitones", true, true, 5),
+    ListItemParameter("6 semitones", true, true, 6),
+    ListItemParameter("7 semitones", true, true, 7),
+    ListItemParameter("sine", true, false, 0),
+    ListItemParameter("tri/saw", true, false, 0),
+    ListItemParameter("pulse", true, false, 0),
+    ListItemParameter("-3 octaves", true, true, -3),
+    ListItemParameter("-2 octaves ", true, true, -2),
+    ListItemParameter("-1 octave", true, true, -1),
+    ListItemParameter("0 octaves", true, true, 0),
+    ListItemParameter("1 octave", true, true, 1),
+    ListItemParameter("2 octaves", true, true, 2),
+    ListItemParameter("3 octaves", true, true, 3),
+    ListItemParameter("-7 semitones", true, true, -7),
+    ListItemParameter("-6 semitones", true, true, -6),
+    ListItemParameter("-5 semitones", true, true, -5),
+    ListItemParameter("-4 semitones", true, true, -4),
+    ListItemParameter("-3 semitones", true, true, -3),
+    ListItemParameter("-2 semitones", true, true, -2),
+    ListItemParameter("-1 semitone", true, true, -1),
+    ListItemParameter("0 semitones", true, true, 0),
+    ListItemParameter("1 semitones", true, true, 1),
+    ListItemParameter("2 semitones", true, true, 2),
+    ListItemParameter("3 semitones", true, true, 3),
+    ListItemParameter("4 semitones", true, true, 4),
+    ListItemParameter("5 semitones", true, true, 5),
+    ListItemParameter("6 semitones", true, true, 6),
+    ListItemParameter("7 semitones", true, true, 7),
+    ListItemParameter("sine", true, false, 0),
+    ListItemParameter("tri/saw", true, false, 0),
+    ListItemParameter("pulse", true, false, 0),
+    ListItemParameter("-3 octaves", true, true, -3),
+    ListItemParameter("-2 octaves ", true, true, -2),
+    ListItemParameter("-1 octave", true, true, -1),
+    ListItemParameter("0 octaves", true, true, 0),
+    ListItemParameter("1 octave", true, true, 1),
+    ListItemParameter("2 octaves", true, true, 2),
+    ListItemParameter("3 octaves", true, true, 3),
+    ListItemParameter("-7 semitones", true, true, -7),
+    ListItemParameter("-6 semitones", true, true, -6),
+    ListItemParameter("-5 semitones", true, true, -5),
+    ListItemParameter("-4 semitones", true, true, -4),
+    ListItemParameter("-3 semitones", true, true, -3),
+    ListItemParameter("-2 semitones", true, true, -2),
+    ListItemParameter("-1 semitone", true, true, -1),
+    ListItemParameter("0 semitones", true, true, 0),
+    ListItemParameter("1 semitones", true, true, 1),
+    ListItemParameter("2 semitones", true, true, 2),
+    ListItemParameter("3 semitones", true, true, 3),
+    ListItemParameter("4 semitones", true, true, 4),
+    ListItemParameter("5 semitones", true, true, 5),
+    ListItemParameter("6 semitones", true, true, 6),
+    ListItemParameter("7 semitones", true, true, 7),
+    ListItemParameter("pink", true, false, 0),
+    ListItemParameter("white", true, false, 0),
+    ListItemParameter("bypass", true, true, 0),
+    ListItemParameter("ob 2-pole LP", true, true, 1),
+    ListItemParameter("tb 3-pole LP", true, true, 2),
+    ListItemParameter("mg 4-pole LP", true, true, 3),
+    ListItemParameter("jp 4-pole LP", true, true, 4),
+    ListItemParameter("rp 4-pole LP", true, true, 5),
+    ListItemParameter("8-pole LP", true, true, 6),
+    ListItemParameter("ob 2-pole BP", true, true, 7),
+    ListItemParameter("6-pole BP", true, true, 8),
+    ListItemParameter("8ve dual BP", true, true, 9),
+    ListItemParameter("bandlimit", true, true, 10),
+    ListItemParameter("ob 2-pole HP", true, true, 11),
+    ListItemParameter("op 4-pole HP", true, true, 12),
+    ListItemParameter("vocal formant 1", true, true, 13),
+    ListItemParameter("vocal formant 2", true, true, 14),
+    ListItemParameter("vocal formant 3", true, true, 15),
+    ListItemParameter("comb filter 1", true, true, 16),
+    ListItemParameter("comb filter 2", true, true, 17),
+    ListItemParameter("comb filter 3", true, true, 18),
+    ListItemParameter("comb filter 4", true, true, 19),
+    ListItemParameter("phase warp", true, true, 20),
+    ListItemParameter("pos", true, false, 0),
+    ListItemParameter("neg", true, false, 0),
+    ListItemParameter("bypass", true, true, 0),
+    ListItemParameter("ob 2-pole LP", true, true, 1),
+    ListItemParameter("tb 3-pole LP", true, true, 2),
+    ListItemParameter("mg 4-pole LP", true, true, 3),
+    ListItemParameter("jp 4-pole LP", true, true, 4),
+    ListItemParameter("rp 4-pole LP", true, true, 5),
+    ListItemParameter("8-pole LP", true, true, 6),
+    ListItemParameter("ob 2-pole BP", true, true, 7),
+    ListItemParameter("6-pole BP", true, true, 8),
+    ListItemParameter("8ve dual BP", true, true, 9),
+    ListItemParameter("bandlimit", true, true, 10),
+    ListItemParameter("ob 2-pole HP", true, true, 11),
+    ListItemParameter("op 4-pole HP", true, true, 12),
+    ListItemParameter("vocal formant 1", true, true, 13),
+    ListItemParameter("vocal formant 2", true, true, 14),
+    ListItemParameter("vocal formant 3", true, true, 15),
+    ListItemParameter("comb filter 1", true, true, 16),
+    ListItemParameter("comb filter 2", true, true, 17),
+    ListItemParameter("comb filter 3", true, true, 18),
+    ListItemParameter("comb filter 4", true, true, 19),
+    ListItemParameter("phase warp", true, true, 20),
+    ListItemParameter("absolute", true, true, 0),
+    ListItemParameter("offset", true, true, 1),
+    ListItemParameter("osc 1", true, false, 0),
+    ListItemParameter("osc 2", true, false, 0),
+    ListItemParameter("osc 3", true, false, 0),
+    ListItemParameter("f1 input", true, false, 0),
+    ListItemParameter("f2 input", true, false, 0),
+    ListItemParameter("ring", true, false, 0),
+    ListItemParameter("noise", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("reset", true, false, 0),
+    ListItemParameter("legato", true, false, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("atk/dcy", true, true, 1),
+    ListItemParameter("entire", true, true, 2),
+    ListItemParameter("held", true, true, 3),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("reset", true, false, 0),
+    ListItemParameter("legato", true, false, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("atk/dcy", true, true, 1),
+    ListItemParameter("entire", true, true, 2),
+    ListItemParameter("held", true, true, 3),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("lin", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("reset", true, false, 0),
+    ListItemParameter("legato", true, false, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("atk/dcy", true, true, 1),
+    ListItemParameter("entire", true, true, 2),
+    ListItemParameter("held", true, true, 3),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("off", true, false, 0),
+    ListItemParameter("on", true, false, 0),
+    ListItemParameter("bypass", true, false, 0),
+    ListItemParameter("compressor", true, false, 0),
+    ListItemParameter("rms limiter", true, false, 0),
+    ListItemParameter("tube overdrive", true, false, 0),
+    ListItemParameter("distortion", true, false, 0),
+    ListItemParameter("tube amp", true, false, 0),
+    ListItemParameter("fuzz pedal", true, false, 0),
+    ListItemParameter("bypass", true, true, 0),
+    ListItemParameter("phaser super", true, true, 4),
+    ListItemParameter("phaser string", true, true, 5),
+    ListItemParameter("flanger theta", true, true, 2),
+    ListItemParameter("flanger thru 0", true, true, 3),
+    ListItemParameter("chorus", true, true, 1),
+    ListItemParameter("vocoder", true, true, 6),
+    ListItemParameter("Sine", true, true, 0),
+    ListItemParameter("Triangle", true, true, 1),
+    ListItemParameter("4", true, true, 0),
+    ListItemParameter("8", true, true, 1),
+    ListItemParameter("16", true, true, 2),
+    ListItemParameter("32", true, true, 3),
+    ListItemParameter("48", true, true, 4),
+    ListItemParameter("64", true, true, 5),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("Sine", true, true, 0),
+    ListItemParameter("Triangle", true, true, 1),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("Sine", true, true, 0),
+    ListItemParameter("Triangle", true, true, 1),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("Sine", true, true, 0),
+    ListItemParameter("Triangle", true, true, 1),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("Sine", true, true, 0),
+    ListItemParameter("Triangle", true, true, 1),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("fx", true, true, 0),
+    ListItemParameter("Aux", true, true, 1),
+    ListItemParameter("Left", true, true, 2),
+    ListItemParameter("Stereo", true, true, 3),
+    ListItemParameter("fx", true, true, 0),
+    ListItemParameter("Aux", true, true, 1),
+    ListItemParameter("Right", true, true, 2),
+    ListItemParameter("Stereo", true, true, 3),
+    ListItemParameter("bypass", true, false, 0),
+    ListItemParameter("mono delay", true, false, 0),
+    ListItemParameter("stereo delay", true, false, 0),
+    ListItemParameter("split L/R delay", true, false, 0),
+    ListItemParameter("hall reverb", true, false, 0),
+    ListItemParameter("plate reverb", true, false, 0),
+    ListItemParameter("room reverb", true, false, 0),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("Fixed", true, true, 0),
+    ListItemParameter("Follow tempo", true, true, 1),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("on", true, true, 1),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("mono", true, true, 0),
+    ListItemParameter("poly", true, true, 1),
+    ListItemParameter("key mono", true, true, 2),
+    ListItemParameter("key poly", true, true, 3),
+    ListItemParameter("tempo lock", true, true, 6),
+    ListItemParameter("legato mono", true, true, 4),
+    ListItemParameter("legato poly", true, true, 5),
+    ListItemParameter("on", true, true, 1),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("mono", true, true, 0),
+    ListItemParameter("poly", true, true, 1),
+    ListItemParameter("key mono", true, true, 2),
+    ListItemParameter("key poly", true, true, 3),
+    ListItemParameter("tempo lock", true, true, 6),
+    ListItemParameter("legato mono", true, true, 4),
+    ListItemParameter("legato poly", true, true, 5),
+    ListItemParameter("on", true, true, 1),
+    ListItemParameter("off", true, true, 0),
+    ListItemParameter("x 16", true, true, 24),
+    ListItemParameter("x 12", true, true, 23),
+    ListItemParameter("x 10 2/3", true, true, 22),
+    ListItemParameter("x 8", true, true, 21),
+    ListItemParameter("x 6", true, true, 20),
+    ListItemParameter("x 5 1/3", true, true, 19),
+    ListItemParameter("x 4", true, true, 18),
+    ListItemParameter("x 3", true, true, 17),
+    ListItemParameter("x 2 2/3", true, true, 16),
+    ListItemParameter("x 2", true, true, 15),
+    ListItemParameter("x 1 1/2", true, true, 14),
+    ListItemParameter("x 1 1/3", true, true, 13),
+    ListItemParameter("x 1", true, true, 12),
+    ListItemParameter("x 3/4", true, true, 11),
+    ListItemParameter("x 2/3", true, true, 10),
+    ListItemParameter("x 1/2", true, true, 9),
+    ListItemParameter("x 3/8", true, true, 8),
+    ListItemParameter("x 1/3", true, true, 7),
+    ListItemParameter("x 1/4", true, true, 6),
+    ListItemParameter("x 3/16", true, true, 5),
+    ListItemParameter("x 1/6", true, true, 4),
+    ListItemParameter("x 1/8", true, true, 3),
+    ListItemParameter("x 3/32", true, true, 2),
+    ListItemParameter("x 1/12", true, true, 1),
+    ListItemParameter("x 1/16", true, true, 0),
+    ListItemParameter("mono", true, true, 0),
+    ListItemParameter("poly", true, true, 1),
+    ListItemParameter("key mono", true, true, 2),
+    ListItemParameter("key poly", true, true, 3),
+    ListItemParameter("tempo lock", true, true, 6),
+    ListItemParameter("legato mono", true, true, 4),
+    ListItemParameter("legato poly", true, true, 5),
+    ListItemParameter("Aftertch", true, true, 0),
+    ListItemParameter("Env 1", true, true, 1),
+    ListItemParameter("Env 2", true, true, 2),
+    ListItemParameter("Env 3", true, true, 3),
+    ListItemParameter("ExpPedal", true, true, 4),
+    ListItemParameter("Keytrack", true, true, 5),
+    ListItemParameter("KeytrackXt", true, true, 6),
+    ListItemParameter("LFO1 Saw", true, true, 7),
+    ListItemParameter("LFO1CSaw", true, true, 8),
+    ListItemParameter("LFO1 Sin", true, true, 9),
+    ListItemParameter("LFO1CSin", true, true, 10),
+    ListItemParameter("LFO1 Sqr", true, true, 11),
+    ListItemParameter("LFO1CSqr", true, true, 12),
+    ListItemParameter("LFO1 Tri", true, true, 13),
+    ListItemParameter("LFO1CTri", true, true, 14),
+    ListItemParameter("LFO2 Saw", true, true, 15),
+    ListItemParameter("LFO2CSaw", true, true, 16),
+    ListItemParameter("LFO2 Sin", true, true, 17),
+    ListItemParameter("LFO2CSin", true, true, 18),
+    ListItemParameter("LFO2 Sqr", true, true, 19),
+    ListItemParameter("LFO2CSqr", true, true, 20),
+    ListItemParameter("LFO2 Tri", true, true, 21),
+    ListItemParameter("LFO2CTri", true, true, 22),
+    ListItemParameter("M1Slider", true, true, 23),
+    ListItemParameter("M2Slider", true, true, 24),
+    ListItemParameter("P Wheel", true, true, 25),
+    ListItemParameter("PortaEfx", true, true, 26),
+    ListItemParameter("PortaLvl", true, true, 27),
+    ListItemParameter("Pressure", true, true, 28),
+    ListItemParameter("RndmGlbl", true, true, 29),
+    ListItemParameter("RndmVoic", true, true, 30),
+    ListItemParameter("SusPedal", true, true, 31),
+    ListItemParameter("Track", true, true, 32),
+    ListItemParameter("TrackStp", true, true, 33),
+    ListItemParameter("Velocity", true, true, 34),
+    ListItemParameter("VelociUp", true, true, 35),
+    ListItemParameter("midi cc 1", true, true, 36),
+    ListItemParameter("midi cc 2", true, true, 37),
+    ListItemParameter("midi cc 3", true, true, 38),
+    ListItemParameter("midi cc 4", true, true, 39),
+    ListItemParameter("midi cc 7", true, true, 40),
+    ListItemParameter("midi cc 8", true, true, 41),
+    ListItemParameter("midi cc 9", true, true, 42),
+    ListItemParameter("midi cc 10", true, true, 43),
+    ListItemParameter("midi cc 11", true, true, 44),
+    ListItemParameter("midi cc 12", true, true, 45),
+    ListItemParameter("midi cc 13", true, true, 46),
+    ListItemParameter("midi cc 14", true, true, 47),
+    ListItemParameter("midi cc 15", true, true, 48),
+    ListItemParameter("midi cc 16", true, true, 49),
+    ListItemParameter("midi cc 17", true, true, 50),
+    ListItemParameter("midi cc 18", true, true, 51),
+    ListItemParameter("midi cc 19", true, true, 52),
+    ListItemParameter("midi cc 20", true, true, 53),
+    ListItemParameter("midi cc 21", true, true, 54),
+    ListItemParameter("midi cc 22", true, true, 55),
+    ListItemParameter("midi cc 23", true, true, 56),
+    ListItemParameter("midi cc 24", true, true, 57),
+    ListItemParameter("midi cc 25", true, true, 58),
+    ListItemParameter("midi cc 26", true, true, 59),
+    ListItemParameter("midi cc 27", true, true, 60),
+    ListItemParameter("midi cc 28", true, true, 61),
+    ListItemParameter("midi cc 29", true, true, 62),
+    ListItemParameter("midi cc 30", true, true, 63),
+    ListItemParameter("midi cc 31", true, true, 64),
+    ListItemParameter("midi cc 66", true, true, 65),
+    ListItemParameter("midi cc 67", true, true, 66),
+    ListItemParameter("midi cc 68", true, true, 67),
+    ListItemParameter("midi cc 69", true, true, 68),
+    ListItemParameter("midi cc 70", true, true, 69),
+    ListItemParameter("midi cc 71", true, true, 70),
+    ListItemParameter("midi cc 72", true, true, 71),
+    ListItemParameter("midi cc 73", true, true, 72),
+    ListItemParameter("midi cc 74", true, true, 73),
+    ListItemParameter("midi cc 75", true, true, 74),
+    ListItemParameter("midi cc 76", true, true, 75),
+    ListItemParameter("midi cc 77", true, true, 76),
+    ListItemParameter("midi cc 78", true, true, 77),
+    ListItemParameter("midi cc 79", true, true, 78),
+    ListItemParameter("midi cc 80", true, true, 79),
+    ListItemParameter("midi cc 81", true, true, 80),
+    ListItemParameter("midi cc 82", true, true, 81),
+    ListItemParameter("midi cc 83", true, true, 82),
+    ListItemParameter("midi cc 84", true, true, 83),
+    ListItemParameter("midi cc 85", true, true, 84),
+    ListItemParameter("midi cc 86", true, true, 85),
+    ListItemParameter("midi cc 87", true, true, 86),
+    ListItemParameter("midi cc 88", true, true, 87),
+    ListItemParameter("midi cc 89", true, true, 88),
+    ListItemParameter("midi cc 90", true, true, 89),
+    ListItemParameter("midi cc 91", true, true, 90),
+    ListItemParameter("midi cc 92", true, true, 91),
+    ListItemParameter("midi cc 93", true, true, 92),
+    ListItemParameter("midi cc 94", true, true, 93),
+    ListItemParameter("midi cc 95", true, true, 94),
+    ListItemParameter("midi cc 102", true, true, 95),
+    ListItemParameter("midi cc 103", true, true, 96),
+    ListItemParameter("midi cc 104", true, true, 97),
+    ListItemParameter("midi cc 105", true, true, 98),
+    ListItemParameter("midi cc 106", true, true, 99),
+    ListItemParameter("midi cc 107", true, true, 100),
+    ListItemParameter("midi cc 108", true, true, 101),
+    ListItemParameter("midi cc 109", true, true, 102),
+    ListItemParameter("midi cc 110", true, true, 103),
+    ListItemParameter("midi cc 111", true, true, 104),
+    ListItemParameter("midi cc 112", true, true, 105),
+    ListItemParameter("midi cc 113", true, true, 106),
+    ListItemParameter("midi cc 114", true, true, 107),
+    ListItemParameter("midi cc 115", true, true, 108),
+    ListItemParameter("midi cc 116", true, true, 109),
+    ListItemParameter("midi cc 117", true, true, 110),
+    ListItemParameter("midi cc 118", true, true, 111),
+    ListItemParameter("midi cc 119", true, true, 112),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NoisBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("None", true, true, 0),
+    ListItemParameter("Aftertch", true, true, 1),
+    ListItemParameter("Env 1", true, true, 2),
+    ListItemParameter("Env 2", true, true, 3),
+    ListItemParameter("Env 3", true, true, 4),
+    ListItemParameter("ExpPedal", true, true, 5),
+    ListItemParameter("Keytrack", true, true, 6),
+    ListItemParameter("KeytrackXt", true, true, 7),
+    ListItemParameter("LFO1 Saw", true, true, 8),
+    ListItemParameter("LFO1CSaw", true, true, 9),
+    ListItemParameter("LFO1 Sin", true, true, 10),
+    ListItemParameter("LFO1CSin", true, true, 11),
+    ListItemParameter("LFO1 Sqr", true, true, 12),
+    ListItemParameter("LFO1CSqr", true, true, 13),
+    ListItemParameter("LFO1 Tri", true, true, 14),
+    ListItemParameter("LFO1CTri", true, true, 15),
+    ListItemParameter("LFO2 Saw", true, true, 16),
+    ListItemParameter("LFO2CSaw", true, true, 17),
+    ListItemParameter("LFO2 Sin", true, true, 18),
+    ListItemParameter("LFO2CSin", true, true, 19),
+    ListItemParameter("LFO2 Sqr", true, true, 20),
+    ListItemParameter("LFO2CSqr", true, true, 21),
+    ListItemParameter("LFO2 Tri", true, true, 22),
+    ListItemParameter("LFO2CTri", true, true, 23),
+    ListItemParameter("M1Slider", true, true, 24),
+    ListItemParameter("M2Slider", true, true, 25),
+    ListItemParameter("P Wheel", true, true, 26),
+    ListItemParameter("PortaEfx", true, true, 27),
+    ListItemParameter("PortaLvl", true, true, 28),
+    ListItemParameter("Pressure", true, true, 29),
+    ListItemParameter("RndmGlbl", true, true, 30),
+    ListItemParameter("RndmVoic", true, true, 31),
+    ListItemParameter("S/H", true, true, 32),
+    ListItemParameter("SusPedal", true, true, 33),
+    ListItemParameter("Track", true, true, 34),
+    ListItemParameter("TrackStp", true, true, 35),
+    ListItemParameter("Velocity", true, true, 36),
+    ListItemParameter("VelociUp", true, true, 37),
+    ListItemParameter("cc1", true, true, 38),
+    ListItemParameter("cc2", true, true, 39),
+    ListItemParameter("cc3", true, true, 40),
+    ListItemParameter("cc4", true, true, 41),
+    ListItemParameter("cc7", true, true, 42),
+    ListItemParameter("cc8", true, true, 43),
+    ListItemParameter("cc9", true, true, 44),
+    ListItemParameter("cc10", true, true, 45),
+    ListItemParameter("cc11", true, true, 46),
+    ListItemParameter("cc12", true, true, 47),
+    ListItemParameter("cc13", true, true, 48),
+    ListItemParameter("cc14", true, true, 49),
+    ListItemParameter("cc15", true, true, 50),
+    ListItemParameter("cc16", true, true, 51),
+    ListItemParameter("cc17", true, true, 52),
+    ListItemParameter("cc18", true, true, 53),
+    ListItemParameter("cc19", true, true, 54),
+    ListItemParameter("cc20", true, true, 55),
+    ListItemParameter("cc21", true, true, 56),
+    ListItemParameter("cc22", true, true, 57),
+    ListItemParameter("cc23", true, true, 58),
+    ListItemParameter("cc24", true, true, 59),
+    ListItemParameter("cc25", true, true, 60),
+    ListItemParameter("cc26", true, true, 61),
+    ListItemParameter("cc27", true, true, 62),
+    ListItemParameter("cc28", true, true, 63),
+    ListItemParameter("cc29", true, true, 64),
+    ListItemParameter("cc30", true, true, 65),
+    ListItemParameter("cc31", true, true, 66),
+    ListItemParameter("cc66", true, true, 67),
+    ListItemParameter("cc67", true, true, 68),
+    ListItemParameter("cc68", true, true, 69),
+    ListItemParameter("cc69", true, true, 70),
+    ListItemParameter("cc70", true, true, 71),
+    ListItemParameter("cc71", true, true, 72),
+    ListItemParameter("cc72", true, true, 73),
+    ListItemParameter("cc73", true, true, 74),
+    ListItemParameter("cc74", true, true, 75),
+    ListItemParameter("cc75", true, true, 76),
+    ListItemParameter("cc76", true, true, 77),
+    ListItemParameter("cc77", true, true, 78),
+    ListItemParameter("cc78", true, true, 79),
+    ListItemParameter("cc79", true, true, 80),
+    ListItemParameter("cc80", true, true, 81),
+    ListItemParameter("cc81", true, true, 82),
+    ListItemParameter("cc82", true, true, 83),
+    ListItemParameter("cc83", true, true, 84),
+    ListItemParameter("cc84", true, true, 85),
+    ListItemParameter("cc85", true, true, 86),
+    ListItemParameter("cc86", true, true, 87),
+    ListItemParameter("cc87", true, true, 88),
+    ListItemParameter("cc88", true, true, 89),
+    ListItemParameter("cc89", true, true, 90),
+    ListItemParameter("cc90", true, true, 91),
+    ListItemParameter("cc91", true, true, 92),
+    ListItemParameter("cc92", true, true, 93),
+    ListItemParameter("cc93", true, true, 94),
+    ListItemParameter("cc94", true, true, 95),
+    ListItemParameter("cc95", true, true, 96),
+    ListItemParameter("cc102", true, true, 97),
+    ListItemParameter("cc103", true, true, 98),
+    ListItemParameter("cc104", true, true, 99),
+    ListItemParameter("cc105", true, true, 100),
+    ListItemParameter("cc106", true, true, 101),
+    ListItemParameter("cc107", true, true, 102),
+    ListItemParameter("cc108", true, true, 103),
+    ListItemParameter("cc109", true, true, 104),
+    ListItemParameter("cc110", true, true, 105),
+    ListItemParameter("cc111", true, true, 106),
+    ListItemParameter("cc112", true, true, 107),
+    ListItemParameter("cc113", true, true, 108),
+    ListItemParameter("cc114", true, true, 109),
+    ListItemParameter("cc115", true, true, 110),
+    ListItemParameter("cc116", true, true, 111),
+    ListItemParameter("cc117", true, true, 112),
+    ListItemParameter("cc118", true, true, 113),
+    ListItemParameter("cc119", true, true, 114),
+    ListItemParameter("None", true, false, 0),
+    ListItemParameter("Pitch", true, true, 1),
+    ListItemParameter("PtchNar", true, true, 2),
+    ListItemParameter("FM Amnt", true, true, 3),
+    ListItemParameter("Osc1Pit", true, true, 4),
+    ListItemParameter("Osc1Nar", true, true, 5),
+    ListItemParameter("Osc1Shp", true, true, 6),
+    ListItemParameter("Osc2Pit", true, true, 7),
+    ListItemParameter("Osc2Nar", true, true, 8),
+    ListItemParameter("Osc2Shp", true, true, 9),
+    ListItemParameter("Osc3Pit", true, true, 10),
+    ListItemParameter("Osc3Nar", true, true, 11),
+    ListItemParameter("Osc3Shp", true, true, 12),
+    ListItemParameter("Osc1Lvl", true, true, 13),
+    ListItemParameter("Osc2Lvl", true, true, 14),
+    ListItemParameter("Osc3Lvl", true, true, 15),
+    ListItemParameter("RingLvl", true, true, 16),
+    ListItemParameter("NoisLvl", true, true, 17),
+    ListItemParameter("ExInLvl", true, true, 18),
+    ListItemParameter("Osc1Bal", true, true, 19),
+    ListItemParameter("Osc2Bal", true, true, 20),
+    ListItemParameter("Osc3Bal", true, true, 21),
+    ListItemParameter("RingBal", true, true, 22),
+    ListItemParameter("NosiBal", true, true, 23),
+    ListItemParameter("ExInLvl", true, true, 24),
+    ListItemParameter("F1F2Lvl", true, true, 25),
+    ListItemParameter("PortaTm", true, true, 26),
+    ListItemParameter("UnsnDtn", true, true, 27),
+    ListItemParameter("Flt1Frq", true, true, 28),
+    ListItemParameter("Flt1Res", true, true, 29),
+    ListItemParameter("Flt1Env", true, true, 30),
+    ListItemParameter("Flt1Ktk", true, true, 31),
+    ListItemParameter("Flt2Frq", true, true, 32),
+    ListItemParameter("Flt2Res", true, true, 33),
+    ListItemParameter("Flt2Env", true, true, 34),
+    ListItemParameter("Flt2Ktk", true, true, 35),
+    ListItemParameter("Flt1Lvl", true, true, 36),
+    ListItemParameter("Flt2Lvl", true, true, 37),
+    ListItemParameter("PfltLvl", true, true, 38),
+    ListItemParameter("Flt1Pan", true, true, 39),
+    ListItemParameter("Flt2Pan", true, true, 40),
+    ListItemParameter("PfltPan", true, true, 41),
+    ListItemParameter("DrivLvl", true, true, 42),
+    ListItemParameter("PgmLvl", true, true, 43),
+    ListItemParameter("Pan", true, true, 44),
+    ListItemParameter("FxMix", true, true, 45),
+    ListItemParameter("Fx1 A", true, true, 46),
+    ListItemParameter("Fx1 B", true, true, 47),
+    ListItemParameter("Fx1 C", true, true, 48),
+    ListItemParameter("Fx1 D", true, true, 49),
+    ListItemParameter("Env1Amp", true, true, 50),
+    ListItemParameter("Env1Rat", true, true, 51),
+    ListItemParameter("Env1Atk", true, true, 52),
+    ListItemParameter("Env1Dcy", true, true, 53),
+    ListItemParameter("Env1STm", true, true, 54),
+    ListItemParameter("Env1SLv", true, true, 55),
+    ListItemParameter("Env1Rel", true, true, 56),
+    ListItemParameter("Env2Amp", true, true, 57),
+    ListItemParameter("Env2Rat", true, true, 58),
+    ListItemParameter("Env2Atk", true, true, 59),
+    ListItemParameter("Env2Dcy", true, true, 60),
+    ListItemParameter("Env2STm", true, true, 61),
+    ListItemParameter("Env2SLv", true, true, 62),
+    ListItemParameter("Env2Rel", true, true, 63),
+    ListItemParameter("Env3Amp", true, true, 64),
+    ListItemParameter("Env3Rat", true, true, 65),
+    ListItemParameter("Env3Atk", true, true, 66),
+    ListItemParameter("Env3Dcy", true, true, 67),
+    ListItemParameter("Env3STm", true, true, 68),
+    ListItemParameter("Env3SLv", true, true, 69),
+    ListItemParameter("Env3Rev", true, true, 70),
+    ListItemParameter("LFO1Rat", true, true, 71),
+    ListItemParameter("LFO1Amp", true, true, 72),
+    ListItemParameter("LFO2Rat", true, true, 73),
+    ListItemParameter("LFO2Amp", true, true, 74),
+    ListItemParameter("S/H Rat", true, true, 75),
+    ListItemParameter("S/H Sm", true, true, 76),
+    ListItemParameter("S/H Amp", true, true, 77),
+    ListItemParameter("Aftertch", true, true, 0),
+    ListItemParameter("Env 1", true, true, 1),
+    ListItemParameter("Env 2", true, true, 2),
+    ListItemParameter("Env 3", true, true, 3),
+    ListItemParameter("ExpPedal", true, true, 4),
+    ListItemParameter("Keytrack", true, true, 5),
+    ListItemParameter("keytrackXt", true, true, 6),
+    ListItemParameter("LFO1 Saw", true, true, 7),
+    ListItemParameter("LFO1CSaw", true, true, 8),
+    ListItemParameter("LFO1 Sin", true, true, 9),
+    ListItemParameter("LFO1CSin", true, true, 10),
+    ListItemParameter("LFO1 Sqr", true, true, 11),
+    ListItemParameter("LFO1CSqr", true, true, 12),
+    ListItemParameter("LFO1 Tri", true, true, 13),
+    ListItemParameter("LFO1CTri", true, true, 14),
+    ListItemParameter("LFO2 Saw", true, true, 15),
+    ListItemParameter("LFO2CSaw", true, true, 16),
+    ListItemParameter("LFO2 Sin", true, true, 17),
+    ListItemParameter("LFO2CSin", true, true, 18),
+    ListItemParameter("LFO2 Sqr", true, true, 19),
+    ListItemParameter("LFO2CSqr", true, true, 20),
+    ListItemParameter("LFO2 Tri", true, true, 21),
+    ListItemParameter("LFO2CTri", true, true, 22),
+    ListItemParameter("M1Slider", true, true, 23),
+    ListItemParameter("M2Slider", true, true, 24),
+    ListItemParameter("P Wheel", true, true, 25),
+    ListItemParameter("PortaEfx", true, true, 26),
+    ListItemParameter("PortaLvl", true, true, 27),
+    ListItemParameter("Pressure", true, true, 28),
+    ListItemParameter("RndmGlbl", true, true, 29),
+    ListItemParameter("RndmVoic", true, true, 30),
+    ListItemParameter("S/H", true, true, 31),
+    ListItemParameter("SusPedal", true, true, 32),
+    ListItemParameter("Velocity", true, true, 33),
+    ListItemParameter("VelociUp", true, true, 34),
+    ListItemParameter("cc1", true, true, 35),
+    ListItemParameter("cc2", true, true, 36),
+    ListItemParameter("cc3", true, true, 37),
+    ListItemParameter("cc4", true, true, 38),
+    ListItemParameter("cc7", true, true, 39),
+    ListItemParameter("cc8", true, true, 40),
+    ListItemParameter("cc9", true, true, 41),
+    ListItemParameter("cc10", true, true, 42),
+    ListItemParameter("cc11", true, true, 43),
+    ListItemParameter("cc12", true, true, 44),
+    ListItemParameter("cc13", true, true, 45),
+    ListItemParameter("cc14", true, true, 46),
+    ListItemParameter("cc15", true, true, 47),
+    ListItemParameter("cc16", true, true, 48),
+    ListItemParameter("cc17", true, true, 49),
+    ListItemParameter("cc18", true, true, 50),
+    ListItemParameter("cc19", true, true, 51),
+    ListItemParameter("cc20", true, true, 52),
+    ListItemParameter("cc21", true, true, 53),
+    ListItemParameter("cc22", true, true, 54),
+    ListItemParameter("cc23", true, true, 55),
+    ListItemParameter("cc24", true, true, 56),
+    ListItemParameter("cc25", true, true, 57),
+    ListItemParameter("cc26", true, true, 58),
+    ListItemParameter("cc27", true, true, 59),
+    ListItemParameter("cc28", true, true, 60),
+    ListItemParameter("cc29", true, true, 61),
+    ListItemParameter("cc30", true, true, 62),
+    ListItemParameter("cc31", true, true, 63),
+    ListItemParameter("cc66", true, true, 64),
+    ListItemParameter("cc67", true, true, 65),
+    ListItemParameter("cc68", true, true, 66),
+    ListItemParameter("cc69", true, true, 67),
+    ListItemParameter("cc70", true, true, 68),
+    ListItemParameter("cc71", true, true, 69),
+    ListItemParameter("cc72", true, true, 70),
+    ListItemParameter("cc73", true, true, 71),
+    ListItemParameter("cc74", true, true, 72),
+    ListItemParameter("cc75", true, true, 73),
+    ListItemParameter("cc76", true, true, 74),
+    ListItemParameter("cc77", true, true, 75),
+    ListItemParameter("cc78", true, true, 76),
+    ListItemParameter("cc79", true, true, 77),
+    ListItemParameter("cc80", true, true, 78),
+    ListItemParameter("cc81", true, true, 79),
+    ListItemParameter("cc82", true, true, 80),
+    ListItemParameter("cc83", true, true, 81),
+    ListItemParameter("cc84", true, true, 82),
+    ListItemParameter("cc85", true, true, 83),
+    ListItemParameter("cc86", true, true, 84),
+    ListItemParameter("cc87", true, true, 85),
+    ListItemParameter("cc88", true, true, 86),
+    ListItemParameter("cc89", true, true, 87),
+    ListItemParameter("cc90", true, true, 88),
+    ListItemParameter("cc91", true, true, 89),
+    ListItemParameter("cc92", true, true, 90),
+    ListItemParameter("cc93", true, true, 91),
+    ListItemParameter("cc94", true, true, 92),
+    ListItemParameter("cc95", true, true, 93),
+    ListItemParameter("cc102", true, true, 94),
+    ListItemParameter("cc103", true, true, 95),
+    ListItemParameter("cc104", true, true, 96),
+    ListItemParameter("cc105", true, true, 97),
+    ListItemParameter("cc106", true, true, 98),
+    ListItemParameter("cc107", true, true, 99),
+    ListItemParameter("cc108", true, true, 100),
+    ListItemParameter("cc109", true, true, 101),
+    ListItemParameter("cc110", true, true, 102),
+    ListItemParameter("cc111", true, true, 103),
+    ListItemParameter("cc112", true, true, 104),
+    ListItemParameter("cc113", true, true, 105),
+    ListItemParameter("cc114", true, true, 106),
+    ListItemParameter("cc115", true, true, 107),
+    ListItemParameter("cc116", true, true, 108),
+    ListItemParameter("cc117", true, true, 109),
+    ListItemParameter("cc118", true, true, 110),
+    ListItemParameter("cc119", true, true, 111),
+    ListItemParameter("custom", true, false, 0),
+    ListItemParameter("bypass", true, false, 0),
+    ListItemParameter("negate", true, false, 0),
+    ListItemParameter("abs val", true, false, 0),
+    ListItemParameter("neg abs", true, false, 0),
+    ListItemParameter("exp+", true, false, 0),
+    ListItemParameter("exp-", true, false, 0),
+    ListItemParameter("zero", true, false, 0),
+    ListItemParameter("maximum", true, false, 0),
+    ListItemParameter("minimum", true, false, 0),
+    ListItemParameter("12", true, false, 0),
+    ListItemParameter("16", true, false, 0),
+};
+
+static constexpr IonSysexParamDesc paramTable[] = {
+    // name, paramname, conversion, min, max, sysexoffset, nrpn, defaultval, cntrloffset, first list item, list items
+    { "name", NULL, IonSysexParam::NAME, 0, 0, 0, -1, 0, 0, 0, 0 },
+    { "Bank", NULL, IonSysexParam::BANK, 0, 8, -1, 100, 0, 0, 0, 0 },
+    { "Program", NULL, IonSysexParam::BANK, 0, 128, -1, 101, 0, 0, 0, 0 },
+    { "MIDI Channel", NULL, IonSysexParam::LIST, 0, 15, -1, 102, 0, 0, 0, 16 },
+    { "panel", NULL, IonSysexParam::LIST, 0, 6, -1, 103, 0, 0, 16, 7 },
+    { "Manual sync", NULL, IonSysexParam::LIST, 0, 1, -1, 200, 0, 0, 23, 2 },
+    { "Midi block", NULL, IonSysexParam::LIST, 0, 1, -1, 201, 0, 0, 25, 2 },
+    { "Pitch Wheel", NULL, IonSysexParam::INT32, -8192, 8191, -1, 205, 0, 0, 27, 0 },
+    { "M1", NULL, IonSysexParam::INT32, 0, 127, -1, 206, 0, 0, 27, 0 },
+    { "M2", NULL, IonSysexParam::INT32, 0, 127, -1, 207, 0, 0, 27, 0 },
+    { "fx", NULL, IonSysexParam::LIST, 0, 1, -1, 275, 0, 0, 27, 2 },
+    { "xyz/s&h", NULL, IonSysexParam::LIST, 0, 1, -1, 276, 0, 0, 29, 2 },
+    { "Knob x", NULL, IonSysexParam::LIST, 0, 161, 792, 411, 0, 0, 31, 162 },
+    { "Knob y", NULL, IonSysexParam::LIST, 0, 161, 800, 412, 0, 0, 193, 162 },
+    { "Knob z", NULL, IonSysexParam::LIST, 0, 161, 808, 413, 0, 0, 355, 162 },
+    { "micron file id", NULL, IonSysexParam::INT16, 0, 16383, 2360, 105, 0, 0, 517, 0 },
+    { "category", NULL, IonSysexParam::LIST, 0, 10, 184, 666, 0, 0, 517, 11 },
+    { "Voice", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 528, 0 },
+    { "Poly mode", NULL, IonSysexParam::LIST, 0, 1, 120, 512, 0, 0, 528, 2 },
+    { "Unison on/off", NULL, IonSysexParam::INT16, 0, 1, 121, -1, 0, 0, 530, 0 },
+    { "Unison voices", NULL, IonSysexParam::LIST, 0, 3, 122, 513, 0, 0, 530, 4 },
+    { "Unison detune", NULL, IonSysexParam::PERCENT, 0, 100, 128, 514, 0, 0, 534, 0 },
+    { "Portamento", NULL, IonSysexParam::LIST, 0, 2, 152, 515, 0, 0, 534, 3 },
+    { "Portamento type", NULL, IonSysexParam::LIST, 0, 3, 126, 516, 0, 0, 537, 4 },
+    { "Portamento time", NULL, IonSysexParam::PORTA_TIME, 0, 127, 136, 517, 0, 0, 541, 0 },
+    { "Pitch wheel mode", NULL, IonSysexParam::LIST, 0, 1, 144, 518, 0, 0, 541, 2 },
+    { "Analog drift", NULL, IonSysexParam::PERCENT, 0, 100, 160, 519, 0, 0, 543, 0 },
+    { "Osc sync", NULL, IonSysexParam::LIST, 0, 4, 278, 520, 0, 0, 543, 5 },
+    { "FM amount", NULL, IonSysexParam::TENTHS_OF_PERCENT, 0, 1000, 328, 521, 0, 0, 548, 0 },
+    { "FM algorithm", NULL, IonSysexParam::LIST, 0, 5, 282, 522, 0, 0, 548, 6 },
+    { "Oscillator 1", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 554, 0 },
+    { "Osc 1 waveform", NULL, IonSysexParam::LIST, 0, 2, 272, 523, 0, 0, 554, 3 },
+    { "Osc 1 shape", NULL, IonSysexParam::PERCENT, -100, 100, 240, 524, 0, 0, 557, 0 },
+    { "Osc 1 octave", NULL, IonSysexParam::LIST, 0, 6, 264, 525, 3, 0, 557, 7 },
+    { "Osc 1 pitch semi", NULL, IonSysexParam::LIST, 0, 14, 268, 526, 7, 0, 564, 15 },
+    { "Osc 1 pitch fine", NULL, IonSysexParam::PITCH_FINE, -999, 999, 200, 527, 0, 0, 579, 0 },
+    { "Osc 1 p wheel range", NULL, IonSysexParam::INT32, 0, 12, 274, 528, 0, 0, 579, 0 },
+    { "Osc 1 level", NULL, IonSysexParam::PERCENT, 0, 100, 360, 541, 100, 0, 579, 0 },
+    { "Osc 1 balance", NULL, IonSysexParam::PRE_BAL, -50, 50, 400, 547, 0, 0, 579, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 579, 0 },
+    { "Oscillator 2", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 579, 0 },
+    { "Osc 2 waveform", NULL, IonSysexParam::LIST, 0, 2, 284, 529, 0, 0, 579, 3 },
+    { "Osc 2 shape", NULL, IonSysexParam::PERCENT, -100, 100, 248, 530, 0, 0, 582, 0 },
+    { "Osc 2 octave", NULL, IonSysexParam::LIST, 0, 6, 296, 531, 3, 0, 582, 7 },
+    { "Osc 2 pitch semi", NULL, IonSysexParam::LIST, 0, 14, 300, 532, 7, 0, 589, 15 },
+    { "Osc 2 pitch fine", NULL, IonSysexParam::PITCH_FINE, -999, 999, 216, 533, 0, 0, 604, 0 },
+    { "Osc 2 p wheel range", NULL, IonSysexParam::INT32, 0, 12, 312, 534, 0, 0, 604, 0 },
+    { "Osc 2 level", NULL, IonSysexParam::PERCENT, 0, 100, 368, 542, 100, 0, 604, 0 },
+    { "Osc 2 balance", NULL, IonSysexParam::PRE_BAL, -50, 50, 408, 548, 0, 0, 604, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 604, 0 },
+    { "Oscillator 3", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 604, 0 },
+    { "Osc 3 waveform", NULL, IonSysexParam::LIST, 0, 2, 286, 535, 0, 0, 604, 3 },
+    { "Osc 3 shape", NULL, IonSysexParam::PERCENT, -100, 100, 256, 536, 0, 0, 607, 0 },
+    { "Osc 3 octave", NULL, IonSysexParam::LIST, 0, 6, 304, 537, 3, 0, 607, 7 },
+    { "Osc 3 pitch semi", NULL, IonSysexParam::LIST, 0, 14, 308, 538, 7, 0, 614, 15 },
+    { "Osc 3 pitch fine", NULL, IonSysexParam::PITCH_FINE, -999, 999, 232, 539, 0, 0, 629, 0 },
+    { "Osc 3 level", NULL, IonSysexParam::PERCENT, 0, 100, 376, 543, 100, 0, 629, 0 },
+    { "Osc 3 balance", NULL, IonSysexParam::PRE_BAL, -50, 50, 416, 549, 0, 0, 629, 0 },
+    { "Osc 3 p wheel range", NULL, IonSysexParam::INT32, 0, 12, 316, 540, 0, 0, 629, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 629, 0 },
+    { "Other Sources", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 629, 0 },
+    { "Ringmod level", NULL, IonSysexParam::PERCENT, 0, 100, 384, 544, 0, 0, 629, 0 },
+    { "Ringmod balance", NULL, IonSysexParam::PRE_BAL, -50, 50, 424, 550, 0, 0, 629, 0 },
+    { "Noise level", NULL, IonSysexParam::PERCENT, 0, 100, 456, 545, 0, 0, 629, 0 },
+    { "Noise balance", NULL, IonSysexParam::PRE_BAL, -50, 50, 440, 551, 0, 0, 629, 0 },
+    { "Noise type", NULL, IonSysexParam::LIST, 0, 1, 463, 554, 0, 0, 629, 2 },
+    { "Extin level", NULL, IonSysexParam::PERCENT, 0, 100, 392, 546, 0, 0, 631, 0 },
+    { "Extin balance", NULL, IonSysexParam::EXT_IN, -100, 100, 432, 552, 0, 0, 631, 0 },
+    { "Filter 1", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 631, 0 },
+    { "Filter 1 type", NULL, IonSysexParam::LIST, 0, 20, 608, 555, 0, 0, 631, 21 },
+    { "Filter 1 freq", NULL, IonSysexParam::FILTER_FREQ, 0, 1023, 512, 556, 1023, 0, 652, 0 },
+    { "Filter 1 res", NULL, IonSysexParam::PERCENT, 0, 100, 536, 557, 0, 0, 652, 0 },
+    { "Filter 1 keytrack", NULL, IonSysexParam::PERCENT, -100, 200, 576, 558, 0, 0, 652, 0 },
+    { "Filter 1 envamt", NULL, IonSysexParam::PERCENT, -100, 100, 552, 559, 0, 0, 652, 0 },
+    { "Filter 1 level", NULL, IonSysexParam::PERCENT, 0, 100, 664, 566, 100, 0, 652, 0 },
+    { "Filter 1 pan", NULL, IonSysexParam::POST_BAL, -100, 100, 704, 569, 0, 0, 652, 0 },
+    { "Filter 1 polarity", NULL, IonSysexParam::LIST, 0, 1, 696, 573, 0, 0, 652, 2 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 654, 0 },
+    { "Filter 2", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 654, 0 },
+    { "Filter 2 type", NULL, IonSysexParam::LIST, 0, 20, 616, 561, 0, 0, 654, 21 },
+    { "Filter 2 absoffset", NULL, IonSysexParam::LIST, 0, 1, 600, 560, 0, 0, 675, 2 },
+    { "Filter 2 abs freq", NULL, IonSysexParam::FILTER_OFFSET_FREQ, 0, 1023, 528, 562, 1023, 0, 677, 0 },
+    { "Filter 2 offset freq", NULL, IonSysexParam::FILTER_OFFSET_OCT, -400, 400, 632, 670, 0, 0, 677, 0 },
+    { "Filter 2 res", NULL, IonSysexParam::PERCENT, 0, 100, 544, 563, 0, 0, 677, 0 },
+    { "Filter 2 keytrack", NULL, IonSysexParam::PERCENT, -100, 200, 592, 564, 0, 0, 677, 0 },
+    { "Filter 2 envamt", NULL, IonSysexParam::PERCENT, -100, 100, 560, 565, 0, 0, 677, 0 },
+    { "Filter 2 level", NULL, IonSysexParam::PERCENT, 0, 100, 672, 567, 0, 0, 677, 0 },
+    { "Filter 2 pan", NULL, IonSysexParam::POST_BAL, -100, 100, 712, 570, 0, 0, 677, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 677, 0 },
+    { "Routing", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 677, 0 },
+    { "f1 to f2 level", NULL, IonSysexParam::PERCENT, 0, 100, 448, 553, 0, 0, 677, 0 },
+    { "Prefilter signal", NULL, IonSysexParam::LIST, 0, 6, 688, 572, 0, 0, 677, 7 },
+    { "Prefilter level", NULL, IonSysexParam::PERCENT, 0, 100, 680, 568, 0, 0, 684, 0 },
+    { "Prefilter pan", NULL, IonSysexParam::POST_BAL, -100, 100, 720, 571, 0, 0, 684, 0 },
+    { "Envelope 1", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 684, 0 },
+    { "Env 1 attack time", "attack 1", IonSysexParam::ENV_TIME, 0, 255, 840, 578, 0, 0, 684, 0 },
+    { "Env 1 decay time", NULL, IonSysexParam::ENV_TIME, 0, 255, 864, 580, 0, 0, 684, 0 },
+    { "Env 1 sus time", NULL, IonSysexParam::ENV_TIME, 0, 256, 920, 582, 256, 0, 684, 0 },
+    { "Env 1 sus level", NULL, IonSysexParam::PERCENT, 0, 100, 888, 583, 100, 0, 684, 0 },
+    { "Env 1 release time", NULL, IonSysexParam::RELEASE_TIME, 0, 256, 968, 584, 0, 0, 684, 0 },
+    { "Env 1 attack slope", NULL, IonSysexParam::LIST, 0, 2, 1056, 579, 0, 0, 684, 3 },
+    { "Env 1 decay slope", NULL, IonSysexParam::LIST, 0, 2, 1060, 581, 0, 0, 687, 3 },
+    { "Env 1 release slope", NULL, IonSysexParam::LIST, 0, 2, 1062, 585, 0, 0, 690, 3 },
+    { "Env 1 reset", NULL, IonSysexParam::LIST, 0, 1, 1036, 587, 0, 0, 693, 2 },
+    { "Env 1 freerun", NULL, IonSysexParam::LIST, 0, 1, 1038, 588, 0, 0, 695, 2 },
+    { "Env 1 loop", NULL, IonSysexParam::LIST, 0, 3, 1032, 589, 3, 0, 697, 4 },
+    { "Env 1 velocity", NULL, IonSysexParam::PERCENT, 0, 100, 1008, 586, 0, 0, 701, 0 },
+    { "Env 1 sus pedal", NULL, IonSysexParam::LIST, 0, 1, 1035, 590, 0, 0, 701, 2 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 703, 0 },
+    { "Envelope 2", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 703, 0 },
+    { "Env 2 attack time", "attack 2", IonSysexParam::ENV_TIME, 0, 255, 848, 591, 0, 0, 703, 0 },
+    { "Env 2 decay time", "decay 2", IonSysexParam::ENV_TIME, 0, 255, 872, 593, 0, 0, 703, 0 },
+    { "Env 2 sus time", "sustime 2", IonSysexParam::ENV_TIME, 0, 256, 936, 595, 256, 0, 703, 0 },
+    { "Env 2 sus level", "suslev 2", IonSysexParam::PERCENT, -100, 100, 896, 596, 100, 0, 703, 0 },
+    { "Env 2 release time", "rel 2", IonSysexParam::RELEASE_TIME, 0, 256, 984, 597, 0, 0, 703, 0 },
+    { "Env 2 attack slope", "attslp 2", IonSysexParam::LIST, 0, 2, 1064, 592, 0, 0, 703, 3 },
+    { "Env 2 decay slope", "decslp 2", IonSysexParam::LIST, 0, 2, 1068, 594, 0, 0, 706, 3 },
+    { "Env 2 release slope", "relslp 2", IonSysexParam::LIST, 0, 2, 1070, 598, 0, 0, 709, 3 },
+    { "Env 2 reset", "reset 2", IonSysexParam::LIST, 0, 1, 1044, 600, 0, 0, 712, 2 },
+    { "Env 2 freerun", "freerun 2", IonSysexParam::LIST, 0, 1, 1046, 601, 0, 0, 714, 2 },
+    { "Env 2 loop", "loop 2 ", IonSysexParam::LIST, 0, 3, 1040, 602, 3, 0, 716, 4 },
+    { "Env 2 velocity", "vel 2", IonSysexParam::PERCENT, 0, 100, 1016, 599, 0, 0, 720, 0 },
+    { "Env 2 sus pedal", "susp 2", IonSysexParam::LIST, 0, 1, 1043, 603, 0, 0, 720, 2 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 722, 0 },
+    { "Envelope 3", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 722, 0 },
+    { "Env 3 attack time", "attack 3", IonSysexParam::ENV_TIME, 0, 255, 856, 604, 0, 0, 722, 0 },
+    { "Env 3 decay time", "decay 3", IonSysexParam::ENV_TIME, 0, 255, 880, 606, 0, 0, 722, 0 },
+    { "Env 3 sus time", "sustime 3", IonSysexParam::ENV_TIME, 0, 256, 952, 608, 256, 0, 722, 0 },
+    { "Env 3 sus level", "suslev 3", IonSysexParam::PERCENT, -100, 100, 904, 609, 100, 0, 722, 0 },
+    { "Env 3 release time", "rel 3", IonSysexParam::RELEASE_TIME, 0, 256, 1000, 610, 0, 0, 722, 0 },
+    { "Env 3 attack slope", "attslp 3", IonSysexParam::LIST, 0, 2, 1072, 605, 0, 0, 722, 3 },
+    { "Env 3 decay slope", "decslp 3", IonSysexParam::LIST, 0, 2, 1076, 607, 0, 0, 725, 3 },
+    { "Env 3 release slope", "relslp 3", IonSysexParam::LIST, 0, 2, 1078, 611, 0, 0, 728, 3 },
+    { "Env 3 reset", "reset 3", IonSysexParam::LIST, 0, 1, 1052, 613, 0, 0, 731, 2 },
+    { "Env 3 freerun", "free 3", IonSysexParam::LIST, 0, 1, 1054, 614, 0, 0, 733, 2 },
+    { "Env 3 loop", "loop 3", IonSysexParam::LIST, 0, 3, 1048, 615, 3, 0, 735, 4 },
+    { "Env 3 velocity", "vel 3", IonSysexParam::PERCENT, 0, 100, 1024, 612, 0, 0, 739, 0 },
+    { "Env 3 sus pedal", "susp 3", IonSysexParam::LIST, 0, 1, 1051, 616, 0, 0, 739, 2 },
+    { "Drive type", NULL, IonSysexParam::LIST, 0, 6, 776, 574, 0, 0, 741, 7 },
+    { "Drive level", NULL, IonSysexParam::PERCENT, 0, 100, 768, 575, 0, 0, 748, 0 },
+    { "Output level", NULL, IonSysexParam::PERCENT, 0, 100, 784, 576, 100, 0, 748, 0 },
+    { "Effects wet mix", NULL, IonSysexParam::WET_DRY, -50, 50, 2240, 577, -50, 0, 748, 0 },
+    { "Modulation type", NULL, IonSysexParam::LIST, 0, 6, 2232, 800, 0, 0, 748, 7 },
+    { "FX1 Feedback", NULL, IonSysexParam::PERCENT, -100, 100, 2248, 844, 0, 0, 755, 0 },
+    { "FX1 Notch Freq", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 845, 0, 0, 755, 0 },
+    { "FX1 LFO Rate", NULL, IonSysexParam::FX_LFO_FREQ, 0, 127, 2264, 846, 0, 0, 755, 0 },
+    { "FX1 LFO Depth", NULL, IonSysexParam::PERCENT, 0, 100, 2272, 847, 0, 0, 755, 0 },
+    { "FX1 LFO Shape", NULL, IonSysexParam::LIST, 0, 1, 2280, 848, 0, 0, 755, 2 },
+    { "FX1 Phaser Stages", NULL, IonSysexParam::LIST, 0, 5, 2288, 849, 0, 0, 757, 6 },
+    { "FX1 LFO Sync", NULL, IonSysexParam::LIST, 0, 1, 2296, 850, 0, 0, 763, 2 },
+    { "FX1 LFO Synced Rate", NULL, IonSysexParam::LIST, 0, 24, 2304, 851, 0, 0, 765, 25 },
+    { "FX1 Feedback", NULL, IonSysexParam::PERCENT, 0, 100, 2248, 854, 0, 0, 790, 0 },
+    { "FX1 Notch Freq", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 855, 0, 0, 790, 0 },
+    { "FX1 LFO Rate", NULL, IonSysexParam::FX_LFO_FREQ, 0, 127, 2264, 856, 0, 0, 790, 0 },
+    { "FX1 LFO Depth", NULL, IonSysexParam::PERCENT, 0, 100, 2272, 857, 0, 0, 790, 0 },
+    { "FX1 LFO Shape", NULL, IonSysexParam::LIST, 0, 1, 2280, 858, 0, 0, 790, 2 },
+    { "FX1 LFO Sync", NULL, IonSysexParam::LIST, 0, 1, 2288, 859, 0, 0, 792, 2 },
+    { "FX1 LFO Synced Rate", NULL, IonSysexParam::LIST, 0, 24, 2304, 861, 0, 0, 794, 25 },
+    { "FX1 Feedback", NULL, IonSysexParam::PERCENT, -100, 100, 2248, 864, 0, 0, 819, 0 },
+    { "FX1 Man Delay", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 865, 0, 0, 819, 0 },
+    { "FX1 LFO Rate", NULL, IonSysexParam::FX_LFO_FREQ, 0, 127, 2264, 866, 0, 0, 819, 0 },
+    { "FX1 LFO Depth", NULL, IonSysexParam::PERCENT, 0, 100, 2272, 867, 0, 0, 819, 0 },
+    { "FX1 LFO Shape", NULL, IonSysexParam::LIST, 0, 1, 2280, 868, 0, 0, 819, 2 },
+    { "FX1 LFO Sync", NULL, IonSysexParam::LIST, 0, 1, 2288, 869, 0, 0, 821, 2 },
+    { "FX1 LFO Synced Rate", NULL, IonSysexParam::LIST, 0, 24, 2304, 871, 0, 0, 823, 25 },
+    { "FX1 Feedback", NULL, IonSysexParam::PERCENT, -100, 100, 2248, 874, 0, 0, 848, 0 },
+    { "FX1 Man Delay", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 875, 0, 0, 848, 0 },
+    { "FX1 LFO Rate", NULL, IonSysexParam::FX_LFO_FREQ, 0, 127, 2264, 876, 0, 0, 848, 0 },
+    { "FX1 LFO Depth", NULL, IonSysexParam::PERCENT, 0, 100, 2272, 877, 0, 0, 848, 0 },
+    { "FX1 LFO Shape", NULL, IonSysexParam::LIST, 0, 1, 2280, 878, 0, 0, 848, 2 },
+    { "FX1 LFO Sync", NULL, IonSysexParam::LIST, 0, 1, 2288, 879, 0, 0, 850, 2 },
+    { "FX1 LFO Synced Rate", NULL, IonSysexParam::LIST, 0, 24, 2304, 881, 0, 0, 852, 25 },
+    { "Chorus Feedback", NULL, IonSysexParam::PERCENT, 0, 100, 2248, 884, 0, 0, 877, 0 },
+    { "Chorus Man Delay", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 885, 0, 0, 877, 0 },
+    { "Chorus LFO Rate", NULL, IonSysexParam::FX_LFO_FREQ, 0, 127, 2264, 886, 0, 0, 877, 0 },
+    { "Chorus LFO Depth", NULL, IonSysexParam::PERCENT, 0, 100, 2272, 887, 0, 0, 877, 0 },
+    { "Chorus LFO Shape", NULL, IonSysexParam::LIST, 0, 1, 2280, 888, 0, 0, 877, 2 },
+    { "Chorus LFO Sync", NULL, IonSysexParam::LIST, 0, 1, 2288, 889, 0, 0, 879, 2 },
+    { "Chorus LFO Synced Rate", NULL, IonSysexParam::LIST, 0, 24, 2304, 891, 0, 0, 881, 25 },
+    { "Voc Analysis Gain", NULL, IonSysexParam::PERCENT, -100, 100, 2248, 894, 0, 0, 906, 0 },
+    { "Vocoder Sib Boost", NULL, IonSysexParam::PERCENT, 0, 100, 2256, 895, 0, 0, 906, 0 },
+    { "Vocoder Decay", NULL, IonSysexParam::PERCENT, 0, 100, 2264, 896, 0, 0, 906, 0 },
+    { "Vocoder Band Shift", NULL, IonSysexParam::PERCENT, -100, 100, 2272, 897, 0, 0, 906, 0 },
+    { "Vocoder Synth In", NULL, IonSysexParam::LIST, 0, 3, 2280, 898, 0, 0, 906, 4 },
+    { "Vocoder Analysis In", NULL, IonSysexParam::LIST, 0, 3, 2288, 899, 0, 0, 910, 4 },
+    { "Voc Analysis Mix", NULL, IonSysexParam::PERCENT, 0, 100, 2296, 900, 0, 0, 914, 0 },
+    { "Delay type", NULL, IonSysexParam::LIST, 0, 6, 2320, 801, 0, 0, 914, 7 },
+    { "Mono Delay Time", NULL, IonSysexParam::MS, 1, 680, 736, 920, 1, 0, 921, 0 },
+    { "Mono Delay Regen", NULL, IonSysexParam::PERCENT, 0, 100, 752, 921, 0, 0, 921, 0 },
+    { "Mono Delay Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 922, 0, 0, 921, 0 },
+    { "Mono Delay Sync", NULL, IonSysexParam::LIST, 0, 1, 1104, 923, 0, 0, 921, 2 },
+    { "Mono Dly Sync Rate", NULL, IonSysexParam::LIST, 0, 12, 1112, 924, 0, 0, 923, 13 },
+    { "Stereo Delay Time", NULL, IonSysexParam::MS, 1, 340, 736, 925, 1, 0, 936, 0 },
+    { "Stereo Delay Regen", NULL, IonSysexParam::PERCENT, 0, 100, 752, 926, 0, 0, 936, 0 },
+    { "Stereo Delay Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 927, 0, 0, 936, 0 },
+    { "Stereo Delay Sync", NULL, IonSysexParam::LIST, 0, 1, 1104, 928, 0, 0, 936, 2 },
+    { "Stereo Dly Sync Rate", NULL, IonSysexParam::LIST, 0, 12, 1112, 929, 0, 0, 938, 13 },
+    { "Split L Delay Time", NULL, IonSysexParam::MS, 1, 340, 736, 930, 1, 0, 951, 0 },
+    { "Split Delay Regen", NULL, IonSysexParam::PERCENT, 0, 100, 752, 931, 0, 0, 951, 0 },
+    { "Split Delay Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 932, 0, 0, 951, 0 },
+    { "Split R Delay Time", NULL, IonSysexParam::MS, 1, 340, 1104, 933, 1, 0, 951, 0 },
+    { "Hall Verb Diffusion", NULL, IonSysexParam::PERCENT, 0, 100, 736, 935, 0, 0, 951, 0 },
+    { "Hall Verb Decay", NULL, IonSysexParam::PERCENT, 0, 100, 752, 936, 0, 0, 951, 0 },
+    { "Hall Verb Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 937, 0, 0, 951, 0 },
+    { "Hall Verb Color", NULL, IonSysexParam::PERCENT, 0, 100, 1104, 938, 0, 0, 951, 0 },
+    { "Plate Verb Diffusion", NULL, IonSysexParam::PERCENT, 0, 100, 736, 940, 0, 0, 951, 0 },
+    { "Plate Verb Decay", NULL, IonSysexParam::PERCENT, 0, 100, 752, 941, 0, 0, 951, 0 },
+    { "Plate Verb Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 942, 0, 0, 951, 0 },
+    { "Plate Verb Color", NULL, IonSysexParam::PERCENT, 0, 100, 1104, 943, 0, 0, 951, 0 },
+    { "Room Verb Diffusion", NULL, IonSysexParam::PERCENT, 0, 100, 736, 945, 0, 0, 951, 0 },
+    { "Room Verb Decay", NULL, IonSysexParam::PERCENT, 0, 100, 752, 946, 0, 0, 951, 0 },
+    { "Room Verb Bright", NULL, IonSysexParam::PERCENT, 0, 100, 1088, 947, 0, 0, 951, 0 },
+    { "Room Verb Color", NULL, IonSysexParam::PERCENT, 0, 100, 1104, 948, 0, 0, 951, 0 },
+    { "fx1 fx2 balance", NULL, IonSysexParam::FX1_FX2_BALANCE, -50, 50, 2312, 742, 0, 0, 951, 0 },
+    { "Lfo 1 tempo sync", NULL, IonSysexParam::LIST, 0, 1, 1200, 617, 0, 0, 951, 2 },
+    { "Lfo 1 rate", NULL, IonSysexParam::LFO_FREQ, 0, 1023, 1128, 618, 0, 0, 953, 0 },
+    { "Lfo 1 synced rate", NULL, IonSysexParam::LIST, 0, 24, 1216, 671, 0, 0, 953, 25 },
+    { "Lfo 1 reset", NULL, IonSysexParam::LIST, 0, 6, 1240, 619, 0, 0, 978, 7 },
+    { "Lfo 1 mod wheel 1", NULL, IonSysexParam::PERCENT, 0, 100, 1152, 620, 0, 0, 985, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 985, 0 },
+    { "lfo 2", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 985, 0 },
+    { "Lfo 2 tempo sync", NULL, IonSysexParam::LIST, 0, 1, 1210, 621, 0, 0, 985, 2 },
+    { "Lfo 2 rate", NULL, IonSysexParam::LFO_FREQ, 0, 1023, 1144, 622, 0, 0, 987, 0 },
+    { "Lfo 2 synced rate", NULL, IonSysexParam::LIST, 0, 24, 1224, 672, 0, 0, 987, 25 },
+    { "Lfo 2 reset", NULL, IonSysexParam::LIST, 0, 6, 1244, 623, 0, 0, 1012, 7 },
+    { "Lfo 2 mod wheel 1", NULL, IonSysexParam::PERCENT, 0, 100, 1160, 624, 0, 0, 1019, 0 },
+    { " ", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 1019, 0 },
+    { "s&h", NULL, IonSysexParam::TEXT_LABEL, 0, 0, -1, -1, 0, 0, 1019, 0 },
+    { "S/H tempo sync", NULL, IonSysexParam::LIST, 0, 1, 1214, 625, 0, 0, 1019, 2 },
+    { "S/H rate", NULL, IonSysexParam::LFO_FREQ, 0, 1023, 1184, 626, 0, 0, 1021, 0 },
+    { "S/H synced rate", NULL, IonSysexParam::LIST, 0, 24, 1232, 673, 0, 0, 1021, 25 },
+    { "S/H reset", NULL, IonSysexParam::LIST, 0, 6, 1192, 627, 0, 0, 1046, 7 },
+    { "S/H input", NULL, IonSysexParam::LIST, 0, 112, 1168, 628, 0, 0, 1053, 113 },
+    { "S/H smoothing", NULL, IonSysexParam::PERCENT, 1, 100, 1201, 629, 1, 0, 1166, 0 },
+    { "Mod 1 source", NULL, IonSysexParam::LIST, 0, 114, 1336, 692, 0, 0, 1166, 115 },
+    { "Mod 1 dest", NULL, IonSysexParam::LIST, 0, 79, 1432, 693, 0, 0, 1281, 78 },
+    { "Mod 1 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1536, 694, 0, 0, 1359, 0 },
+    { "Mod 1 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1728, 695, 0, 0, 1359, 0 },
+    { "Mod 2 source", NULL, IonSysexParam::LIST, 0, 114, 1344, 696, 0, 0, 1359, 115 },
+    { "Mod 2 dest", NULL, IonSysexParam::LIST, 0, 79, 1440, 697, 0, 0, 1474, 78 },
+    { "Mod 2 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1552, 698, 0, 0, 1552, 0 },
+    { "Mod 2 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1744, 699, 0, 0, 1552, 0 },
+    { "Mod 3 source", NULL, IonSysexParam::LIST, 0, 114, 1352, 700, 0, 0, 1552, 115 },
+    { "Mod 3 dest", NULL, IonSysexParam::LIST, 0, 79, 1448, 701, 0, 0, 1667, 78 },
+    { "Mod 3 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1568, 702, 0, 0, 1745, 0 },
+    { "Mod 3 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1760, 703, 0, 0, 1745, 0 },
+    { "Mod 4 source", NULL, IonSysexParam::LIST, 0, 114, 1360, 704, 0, 0, 1745, 115 },
+    { "Mod 4 dest", NULL, IonSysexParam::LIST, 0, 79, 1456, 705, 0, 0, 1860, 78 },
+    { "Mod 4 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1584, 706, 0, 0, 1938, 0 },
+    { "Mod 4 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1776, 707, 0, 0, 1938, 0 },
+    { "Mod 5 source", NULL, IonSysexParam::LIST, 0, 114, 1368, 708, 0, 0, 1938, 115 },
+    { "Mod 5 dest", NULL, IonSysexParam::LIST, 0, 79, 1464, 709, 0, 0, 2053, 78 },
+    { "Mod 5 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1600, 710, 0, 0, 2131, 0 },
+    { "Mod 5 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1792, 711, 0, 0, 2131, 0 },
+    { "Mod 6 source", NULL, IonSysexParam::LIST, 0, 114, 1376, 712, 0, 0, 2131, 115 },
+    { "Mod 6 dest", NULL, IonSysexParam::LIST, 0, 79, 1472, 713, 0, 0, 2246, 78 },
+    { "Mod 6 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1616, 714, 0, 0, 2324, 0 },
+    { "Mod 6 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1808, 715, 0, 0, 2324, 0 },
+    { "Mod 7 source", NULL, IonSysexParam::LIST, 0, 114, 1384, 716, 0, 0, 2324, 115 },
+    { "Mod 7 dest", NULL, IonSysexParam::LIST, 0, 79, 1480, 717, 0, 0, 2439, 78 },
+    { "Mod 7 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1632, 718, 0, 0, 2517, 0 },
+    { "Mod 7 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1824, 719, 0, 0, 2517, 0 },
+    { "Mod 8 source", NULL, IonSysexParam::LIST, 0, 114, 1392, 720, 0, 0, 2517, 115 },
+    { "Mod 8 dest", NULL, IonSysexParam::LIST, 0, 79, 1488, 721, 0, 0, 2632, 78 },
+    { "Mod 8 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1648, 722, 0, 0, 2710, 0 },
+    { "Mod 8 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1840, 723, 0, 0, 2710, 0 },
+    { "Mod 9 source", NULL, IonSysexParam::LIST, 0, 114, 1400, 724, 0, 0, 2710, 115 },
+    { "Mod 9 dest", NULL, IonSysexParam::LIST, 0, 79, 1496, 725, 0, 0, 2825, 78 },
+    { "Mod 9 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1664, 726, 0, 0, 2903, 0 },
+    { "Mod 9 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1856, 727, 0, 0, 2903, 0 },
+    { "Mod 10 source", NULL, IonSysexParam::LIST, 0, 114, 1408, 728, 0, 0, 2903, 115 },
+    { "Mod 10 dest", NULL, IonSysexParam::LIST, 0, 79, 1504, 729, 0, 0, 3018, 78 },
+    { "Mod 10 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1680, 730, 0, 0, 3096, 0 },
+    { "Mod 10 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1872, 731, 0, 0, 3096, 0 },
+    { "Mod 11 source", NULL, IonSysexParam::LIST, 0, 114, 1416, 732, 0, 0, 3096, 115 },
+    { "Mod 11 dest", NULL, IonSysexParam::LIST, 0, 79, 1512, 733, 0, 0, 3211, 78 },
+    { "Mod 11 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1696, 734, 0, 0, 3289, 0 },
+    { "Mod 11 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1888, 735, 0, 0, 3289, 0 },
+    { "Mod 12 source", NULL, IonSysexParam::LIST, 0, 114, 1424, 736, 0, 0, 3289, 115 },
+    { "Mod 12 dest", NULL, IonSysexParam::LIST, 0, 79, 1520, 737, 0, 0, 3404, 78 },
+    { "Mod 12 level", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1712, 738, 0, 0, 3482, 0 },
+    { "Mod 12 offset", NULL, IonSysexParam::TENTHS_OF_PERCENT, -1000, 1000, 1904, 739, 0, 0, 3482, 0 },
+    { "Tracking input", NULL, IonSysexParam::LIST, 0, 111, 1912, 630, 0, 0, 3482, 112 },
+    { "Tracking preset", NULL, IonSysexParam::LIST, 0, 9, 2192, 631, 0, 0, 3594, 10 },
+    { "tracking numpoints", NULL, IonSysexParam::LIST, 0, 1, 1920, 632, 0, 0, 3604, 2 },
+    { "tracking point -16", NULL, IonSysexParam::PERCENT, -100, 100, 1928, 633, 0, 0, 3606, 0 },
+    { "tracking point -15", NULL, IonSysexParam::PERCENT, -100, 100, 1936, 634, 0, 0, 3606, 0 },
+    { "tracking point -14", NULL, IonSysexParam::PERCENT, -100, 100, 1944, 635, 0, 0, 3606, 0 },
+    { "tracking point -13", NULL, IonSysexParam::PERCENT, -100, 100, 1952, 636, 0, 0, 3606, 0 },
+    { "tracking point -12", NULL, IonSysexParam::PERCENT, -100, 100, 1960, 637, 0, 0, 3606, 0 },
+    { "tracking point -11", NULL, IonSysexParam::PERCENT, -100, 100, 1968, 638, 0, 0, 3606, 0 },
+    { "tracking point -10", NULL, IonSysexParam::PERCENT, -100, 100, 1976, 639, 0, 0, 3606, 0 },
+    { "tracking point -9", NULL, IonSysexParam::PERCENT, -100, 100, 1984, 640, 0, 0, 3606, 0 },
+    { "tracking point -8", NULL, IonSysexParam::PERCENT, -100, 100, 1992, 641, 0, 0, 3606, 0 },
+    { "tracking point -7", NULL, IonSysexParam::PERCENT, -100, 100, 2000, 642, 0, 0, 3606, 0 },
+    { "tracking point -6", NULL, IonSysexParam::PERCENT, -100, 100, 2008, 643, 0, 0, 3606, 0 },
+    { "tracking point -5", NULL, IonSysexParam::PERCENT, -100, 100, 2016, 644, 0, 0, 3606, 0 },
+    { "tracking point -4", NULL, IonSysexParam::PERCENT, -100, 100, 2024, 645, 0, 0, 3606, 0 },
+    { "tracking point -3", NULL, IonSysexParam::PERCENT, -100, 100, 2032, 646, 0, 0, 3606, 0 },
+    { "tracking point -2", NULL, IonSysexParam::PERCENT, -100, 100, 2040, 647, 0, 0, 3606, 0 },
+    { "tracking point -1", NULL, IonSysexParam::PERCENT, -100, 100, 2048, 648, 0, 0, 3606, 0 },
+    { "tracking point 0", NULL, IonSysexParam::PERCENT, -100, 100, 2056, 649, 0, 0, 3606, 0 },
+    { "tracking point 1", NULL, IonSysexParam::PERCENT, -100, 100, 2064, 650, 0, 0, 3606, 0 },
+    { "tracking point 2", NULL, IonSysexParam::PERCENT, -100, 100, 2072, 651, 0, 0, 3606, 0 },
+    { "tracking point 3", NULL, IonSysexParam::PERCENT, -100, 100, 2080, 652, 0, 0, 3606, 0 },
+    { "tracking point 4", NULL, IonSysexParam::PERCENT, -100, 100, 2088, 653, 0, 0, 3606, 0 },
+    { "tracking point 5", NULL, IonSysexParam::PERCENT, -100, 100, 2096, 654, 0, 0, 3606, 0 },
+    { "tracking point 6", NULL, IonSysexParam::PERCENT, -100, 100, 2104, 655, 0, 0, 3606, 0 },
+    { "tracking point 7", NULL, IonSysexParam::PERCENT, -100, 100, 2112, 656, 0, 0, 3606, 0 },
+    { "tracking point 8", NULL, IonSysexParam::PERCENT, -100, 100, 2120, 657, 0, 0, 3606, 0 },
+    { "tracking point 9", NULL, IonSysexParam::PERCENT, -100, 100, 2128, 658, 0, 0, 3606, 0 },
+    { "tracking point 10", NULL, IonSysexParam::PERCENT, -100, 100, 2136, 659, 0, 0, 3606, 0 },
+    { "tracking point 11", NULL, IonSysexParam::PERCENT, -100, 100, 2144, 660, 0, 0, 3606, 0 },
+    { "tracking point 12", NULL, IonSysexParam::PERCENT, -100, 100, 2152, 661, 0, 0, 3606, 0 },
+    { "tracking point 13", NULL, IonSysexParam::PERCENT, -100, 100, 2160, 662, 0, 0, 3606, 0 },
+    { "tracking point 14", NULL, IonSysexParam::PERCENT, -100, 100, 2168, 663, 0, 0, 3606, 0 },
+    { "tracking point 15", NULL, IonSysexParam::PERCENT, -100, 100, 2176, 664, 0, 0, 3606, 0 },
+    { "tracking point 16", NULL, IonSysexParam::PERCENT, -100, 100, 2184, 665, 0, 0, 3606, 0 },
+};
+
+static constexpr int NUM_PARAMS = 318;
+
+// nrpn -> sysex value, inverse of the tables in mapping.h
+static constexpr int mod_dst_n_to_s[78] = {
+    73,1,79,11,2,5,8,3,6,9,4,7,10,12,13,14,15,16,17,18,
+    19,20,21,22,23,24,25,26,27,28,29,30,31,32,33,34,42,43,44,45,
+    46,47,48,49,51,74,75,76,77,78,52,53,54,55,56,57,58,59,60,61,
+    62,63,64,65,66,67,68,69,70,71,72,35,36,37,38,39,40,41
+};
+static constexpr int mod_src_n_to_s[115] = {
+    0,36,9,10,11,8,3,114,16,17,12,13,18,19,14,15,24,25,20,21,
+    26,27,22,23,4,5,6,32,31,35,30,29,28,7,33,34,1,2,37,38,
+    39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,
+    59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,
+    79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,
+    99,100,101,102,103,104,105,106,107,108,109,110,111,112,113
+};
+static constexpr int sh_n_to_s[113] = {
+    34,8,9,10,7,2,112,15,16,11,12,17,18,13,14,23,24,19,20,25,
+    26,21,22,3,4,5,30,29,33,28,27,6,31,32,0,1,35,36,37,38,
+    39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,
+    59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,
+    79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,
+    99,100,101,102,103,104,105,106,107,108,109,110,111
+};
+static constexpr int filter_n_to_s[21] = {
+    0,2,6,1,7,5,8,3,10,9,17,4,18,14,15,16,12,13,19,20,
+    11
+};
+static constexpr int tracking_n_to_s[112] = {
+    1,8,9,10,7,2,111,15,16,11,12,17,18,13,14,23,24,19,20,25,
+    26,21,22,3,4,5,31,30,32,29,28,27,6,0,33,34,35,36,37,38,
+    39,40,41,42,43,44,45,46,47,48,49,50,51,52,53,54,55,56,57,58,
+    59,60,61,62,63,64,65,66,67,68,69,70,71,72,73,74,75,76,77,78,
+    79,80,81,82,83,84,85,86,87,88,89,90,91,92,93,94,95,96,97,98,
+    99,100,101,102,103,104,105,106,107,108,109,110
+};
+
+#endif
@@ -0,0 +1,66 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// timing and the programs for the benchmarks. each takes [-n passes] and .syx files or
+// directories, and runs on their programs plus a fixed set of random ones, so that runs
+// on different machines and revisions can be compared.
+
+#ifndef _BENCH_H_
+#define _BENCH_H_
+
+#include "TestSupport.h"
+
+#define RANDOM_PROGRAMS 256
+
+static int passes = 200;
+static vector<unsigned char> programs;   // SYSEX_PROGRAM_SIZE bytes each
+static int numPrograms = 0;
+static volatile int sink;                // keeps the optimiser from dropping the work
+
+static int64 ticks()
+{
+    return Time::getHighResolutionTicks();
+}
+
+static double nanos(int64 t)
+{
+    return Time::highResolutionTicksToSeconds(t) * 1e9;
+}
+
+static void report(const char *what, int64 t, int64 count, const char *unit = "patch")
+{
+    printf("%-44s %10.1f ns/%s\n", what, nanos(t) / (double) count, unit);
+}
+
+static unsigned char *program(int i)
+{
+    return &programs[(size_t) i * SYSEX_PROGRAM_SIZE];
+}
+
+// reads the command line into passes and programs
+static void loadPrograms(int argc, char **argv)
+{
+    Array<File> files;
+    for (int a = 1; a < argc; a++) {
+        if ((strcmp(argv[a], "-n") == 0) && (a + 1 < argc)) {
+            passes = jmax(1, atoi(argv[++a]));
+            continue;
+        }
+        addCorpusFiles(argv[a], files);
+    }
+    for (int i = 0; i < files.size(); i++) {
+        numPrograms += addPrograms(files[i], programs);
+    }
+    int corpus = numPrograms;
+    addRandomPrograms(RANDOM_PROGRAMS, programs);
+    numPrograms += RANDOM_PROGRAMS;
+    printf("%d programs (%d from files, %d random), %d passes\n", numPrograms, corpus, RANDOM_PROGRAMS, passes);
+}
+
+#endif
@@ -0,0 +1,172 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// ns per patch of the sysex codec, on the programs of the given files plus a fixed set
+// of random ones, so that runs on different machines and revisions can be compared.
+//
+// usage: codec_bench [-n passes] [.syx file or directory]...
+
+#include "Bench.h"
+
+// in IonSysexParam::Conversion order
+static const char *conversionNames[IonSysexParam::NUM_CONVERSIONS] = {
+    "NONE", "LIST", "PERCENT", "TENTHS_OF_PERCENT", "INT32", "INT16", "INT8", "ENV_TIME",
+    "FX1_FX2_BALANCE", "FILTER_FREQ", "PITCH_FINE", "PORTA_TIME", "LFO_FREQ", "RELEASE_TIME",
+    "FILTER_OFFSET_FREQ", "FILTER_OFFSET_OCT", "BALANCE", "TENTHS", "NAME", "TEXT_LABEL",
+    "WET_DRY", "PRE_BAL", "POST_BAL", "EXT_IN", "FX_LFO_FREQ", "MS", "OCTAVE", "SEMITONE", "BANK"
+};
+
+static void benchProgramIo()
+{
+    IonSysexParams params;
+    unsigned char out[SYSEX_PROGRAM_SIZE];
+    int64 count = (int64) passes * numPrograms;
+    int64 t;
+
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            params.parseParamsFromContent(program(i) + 1, SYSEX_CONTENT_SIZE);
+        }
+    }
+    int64 parse = ticks() - t;
+    report("parseParamsFromContent", parse, count);
+
+    // reading a program leaves the image stale, so this is a full encode
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            params.parseParamsFromContent(program(i) + 1, SYSEX_CONTENT_SIZE);
+            params.getAsSysexMessage(out);
+        }
+    }
+    report("getAsSysexMessage, full encode", jmax((int64) 0, ticks() - t - parse), count);
+
+    int n = params.numParams();
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            IonSysexParam *p = params.getParam((pass * numPrograms + i) % n);
+            p->setValue(p->getMin() + (i % (p->getMax() - p->getMin() + 1)));
+            params.getAsSysexMessage(out);
+        }
+    }
+    report("getAsSysexMessage, one parameter changed", ticks() - t, count);
+
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            params.getAsSysexMessage(out);
+        }
+    }
+    report("getAsSysexMessage, unchanged", ticks() - t, count);
+    sink = out[100];
+}
+
+static void benchKernels()
+{
+    unsigned char raw[SYSEX_RAW_SIZE + 5];
+    unsigned char encoded[SYSEX_ENCODED_SIZE];
+    int64 count = (int64) passes * numPrograms;
+    int64 t;
+    int acc = 0;
+
+    memset(raw, 0, sizeof(raw));
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            midiUnpack7(program(i) + 1 + 4 + sizeof(unsigned int) + sizeof(ProgramHeader), raw, SYSEX_ENCODED_SIZE / 8);
+            acc += raw[i % SYSEX_RAW_SIZE];
+        }
+    }
+    report("midiUnpack7 (decodeFromMidi)", ticks() - t, count);
+
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            raw[i % SYSEX_RAW_SIZE] = (unsigned char) pass;
+            midiPack7(raw, encoded, SYSEX_ENCODED_SIZE / 8);
+            acc += encoded[i % SYSEX_ENCODED_SIZE];
+        }
+    }
+    report("midiPack7 (encodeToMidi)", ticks() - t, count);
+
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < numPrograms; i++) {
+            raw[i % SYSEX_RAW_SIZE] = (unsigned char) pass;
+            acc += programChecksum(raw, SYSEX_RAW_SIZE);
+        }
+    }
+    report("programChecksum", ticks() - t, count);
+
+    IonSysexBank bank;
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        acc += bank.parse(&programs[0], programs.size(), 1);
+    }
+    report("IonSysexBank::parse, one thread", ticks() - t, count);
+
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        for (int i = 0; i < bank.numPrograms(); i++) {
+            acc += (int) IonSysexSchema::get().canonicalHash(bank.getValues(i));
+        }
+    }
+    report("IonSysexSchema::canonicalHash", ticks() - t, (int64) passes * bank.numPrograms());
+    sink = acc;
+}
+
+static void benchConvertedValues()
+{
+    // one IonSysexParams per program, so every call sees realistic values
+    OwnedArray<IonSysexParams> loaded;
+    for (int i = 0; i < numPrograms; i++) {
+        IonSysexParams *params = loaded.add(new IonSysexParams());
+        params->readProgramContent(program(i) + 1, SYSEX_CONTENT_SIZE);
+    }
+    int acc = 0;
+    for (int c = 0; c < IonSysexParam::NUM_CONVERSIONS; c++) {
+        Array<int> users;
+        for (unsigned int k = 0; k < loaded[0]->numParams(); k++) {
+            if (loaded[0]->getParam(k)->getConversionType() == c) {
+                users.add(k);
+            }
+        }
+        if (users.size() == 0) {
+            continue;
+        }
+        // the display strings are built on first use, leave that out
+        for (int k = 0; k < users.size(); k++) {
+            acc += loaded[0]->getParam(users[k])->getConvertedValue(0).length();
+        }
+        int64 t = ticks();
+        for (int pass = 0; pass < passes; pass++) {
+            for (int i = 0; i < numPrograms; i++) {
+                IonSysexParams *params = loaded[i];
+                for (int k = 0; k < users.size(); k++) {
+                    acc += params->getParam(users[k])->getConvertedValue(0).length();
+                }
+            }
+        }
+        String what = String("getConvertedValue ") + conversionNames[c];
+        report(what.toRawUTF8(), ticks() - t, (int64) passes * numPrograms * users.size(), "call");
+    }
+    sink = acc;
+}
+
+int main(int argc, char **argv)
+{
+    loadPrograms(argc, argv);
+
+    benchProgramIo();
+    benchKernels();
+    benchConvertedValues();
+    return 0;
+}
@@ -0,0 +1,90 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// going from one program of the corpus to the next through a DeviceShadow has to end up
+// with the same nrpn values as a full sync, in fewer bytes, and pick the quicker of the
+// diff and a program dump.
+
+#include "TestSupport.h"
+#include "../Source/DeviceShadow.h"
+#include "../Source/SyxScanner.h"
+
+#include <map>
+
+class DeviceShadowTest : public UnitTest {
+public:
+    DeviceShadowTest() : UnitTest("DeviceShadow") {}
+
+    void runTest()
+    {
+        beginTest("program to program");
+        SyxScanner scanner;
+        scanner.scanFiles(goodCorpus(), 2);
+
+        unsigned char buf[BANK_PROGRAM_MSG_SIZE + 1024 * NRPN_MSG_SIZE];
+        IonSysexParams params;
+        DeviceShadow shadow;
+        NrpnStream stream;
+        map<int, int> device;
+        Receiver receiver;
+        int64 full = 0, diff = 0;
+
+        for (int i = 0; i < scanner.numPrograms(); i++) {
+            MemoryMappedFile mapped(scanner.getFile(scanner.getProgramFile(i)), MemoryMappedFile::readOnly);
+            params.readProgramContent((const unsigned char *) mapped.getData() + scanner.getProgramOffset(i) + 1, SYSEX_CONTENT_SIZE);
+            // a dump is quicker to a device that could hold anything, a few nrpns to one that's close
+            int n = shadow.encodeDiff(0, params, stream);
+            if (i == 0) {
+                expect(DeviceShadow::prefersSysex(n), "DeviceShadow doesn't sync an unknown device by program dump");
+            }
+            apply(device, receiver, shadow.getDiff(), n);
+            stream.endBatch();   // as the plugin sends it
+            diff += n;
+
+            // the device has to have every parameter of the micron's, and nothing is left to send
+            full += encodeProgramNrpns(0, params, buf, sizeof(buf));
+            bool same = (shadow.encodeDiff(0, params, stream, buf, sizeof(buf)) == 0) && !DeviceShadow::prefersSysex(0);
+            for (unsigned int p = 0; same && (p < params.numParams()); p++) {
+                IonSysexParam *param = params.getParam(p);
+                int nrpn = params.wireNrpn(p);
+                if (param->hasNrpn() && (param->getNrpn() >= 512) && (nrpn != NO_NRPN)) {
+                    same = (device.count(nrpn) == 1) && (device[nrpn] == (param->getNrpnValue() & 0x3fff));
+                }
+            }
+            if (!same) {
+                expect(false, "DeviceShadow doesn't sync program " + String(i));
+                return;
+            }
+        }
+        expect(diff <= full, "DeviceShadow sends more than full syncs");
+
+        // a program dump sent instead of a diff takes its place, program change included:
+        // sending that after all would load the stored program over the dump
+        beginTest("a program dump instead of the diff");
+        params.getParamByNrpn(100)->setValue(1);
+        params.getParamByNrpn(101)->setValue(5);
+        shadow.forget();
+        expect(DeviceShadow::prefersSysex(shadow.encodeDiff(0, params, stream)), "a diff to an unknown device is quicker than a dump");
+        shadow.setProgram(params);
+        expect(shadow.encodeDiff(0, params, stream) == 0, "there's more to send after a program dump");
+    }
+
+    // applies what receive() makes of a stream to a device's nrpn values
+    static void apply(map<int, int> &device, Receiver &r, const unsigned char *buf, int size)
+    {
+        vector<int> events = receive(buf, size, r);
+        for (size_t i = 0; i < events.size(); i++) {
+            if (events[i] >= 0) {
+                device[events[i] >> 14] = events[i] & 0x3fff;
+            }
+        }
+    }
+};
+
+static DeviceShadowTest deviceShadowTest;
@@ -0,0 +1,109 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// round trips the golden corpus: every program dump in it has to decode and encode
+// back to exactly the bytes it was read from, through the full and the incremental
+// encoder, and decode to the same values through IonSysexBank. in the damaged files
+// the broken messages have to be found, and the good dumps among them still round trip.
+
+#include "TestSupport.h"
+
+class GoldenTest : public UnitTest {
+public:
+    GoldenTest() : UnitTest("golden round trip") {}
+
+    void runTest()
+    {
+        beginTest("IonSysexTests");
+        expect(IonSysexTests(), "IonSysexTests failed");
+
+        beginTest("good program dumps");
+        for (int f = 0; f < goodCorpus().size(); f++) {
+            const File &file = goodCorpus().getReference(f);
+            MemoryBlock data;
+            IonSysexBank bank;
+            expect(loadBank(file, data, bank) && (bank.numPrograms() > 0), file.getFullPathName() + ": no programs");
+            for (int i = 0; i < bank.numMessages(); i++) {
+                const IonSysexBank::Message &m = bank.getMessage(i);
+                expect(m.status == PROGRAM_OK, where(file, i) + "not a good program dump");
+                if (m.status == PROGRAM_OK) {
+                    checkProgram(file, m.program, (const unsigned char *) data.getData() + m.offset, bank.getValues(m.program));
+                }
+            }
+        }
+
+        beginTest("damaged files");
+        for (int f = 0; f < damagedCorpus().size(); f++) {
+            const File &file = damagedCorpus().getReference(f);
+            MemoryBlock data;
+            IonSysexBank bank;
+            expect(loadBank(file, data, bank) && (bank.numErrors() > 0), file.getFullPathName() + ": no broken messages");
+            for (int i = 0; i < bank.numMessages(); i++) {
+                const IonSysexBank::Message &m = bank.getMessage(i);
+                unsigned char *message = (unsigned char *) data.getData() + m.offset;
+                if (m.status == PROGRAM_OK) {
+                    checkProgram(file, m.program, message, bank.getValues(m.program));
+                } else if (m.status == PROGRAM_BAD_CHECKSUM) {
+                    // fixing the checksum makes a good dump of it
+                    IonSysexBank fixed;
+                    expect((rechecksumProgram(message, m.size) == PROGRAM_BAD_CHECKSUM) &&
+                           (fixed.parse(message, m.size) == 1) && (fixed.getMessage(0).status == PROGRAM_OK),
+                           where(file, i) + "rechecksumProgram doesn't fix the checksum");
+                }
+            }
+        }
+    }
+
+    void checkProgram(const File &file, int idx, const unsigned char *program, const int16 *bankValues)
+    {
+        IonSysexParams params;
+        unsigned char out[SYSEX_PROGRAM_SIZE];
+
+        if (!params.readProgramContent(program + 1, SYSEX_CONTENT_SIZE)) {
+            expect(false, where(file, idx) + "can't read program");
+            return;
+        }
+        bool values = true;
+        for (unsigned int i = 0; values && (i < params.numParams()); i++) {
+            values = (params.getParam(i)->getValue() == bankValues[i]);
+        }
+        expect(values, where(file, idx) + "IonSysexBank decodes different values");
+
+        params.writeProgram(out, sizeof(out));
+        expect(memcmp(out, program, SYSEX_PROGRAM_SIZE) == 0, where(file, idx) + "full encode differs");
+
+        // change one parameter at a time: the incremental write, which only patches the byte
+        // groups of that parameter, has to match a full encode of the same values. the fx
+        // selectors are left alone, changing them re-encodes the whole program anyway.
+        IonSysexParams full;
+        unsigned char expected[SYSEX_PROGRAM_SIZE];
+        bool same = true;
+        for (unsigned int i = 0; same && (i < params.numParams()); i++) {
+            IonSysexParam *param = params.getParam(i);
+            int conv = param->getConversionType();
+            if ((param->getNrpn() == FX1_SELECTOR) || (param->getNrpn() == FX2_SELECTOR) ||
+                (conv == IonSysexParam::NAME) || (conv == IonSysexParam::TEXT_LABEL) || (param->getMin() == param->getMax())) {
+                continue;
+            }
+            int old = param->getValue();
+            int v = (old == param->getMin()) ? param->getMax() : param->getMin();
+            param->setValue(v);
+            params.writeProgram(out, sizeof(out));
+            full.readProgramContent(program + 1, SYSEX_CONTENT_SIZE);
+            full.getParam(i)->setValue(v);
+            full.writeProgram(expected, sizeof(expected));
+            same = (memcmp(out, expected, SYSEX_PROGRAM_SIZE) == 0);
+            param->setValue(old);
+        }
+        params.writeProgram(out, sizeof(out));
+        expect(same && (memcmp(out, program, SYSEX_PROGRAM_SIZE) == 0), where(file, idx) + "incremental encode differs");
+    }
+};
+
+static GoldenTest goldenTest;
@@ -0,0 +1,156 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// a simulated micron filled with the programs of the corpus has to back up and restore
+// through HardwareBackup, writing only the slots that changed, and a slow one has to be
+// read right even though it answers late.
+
+#include "TestSupport.h"
+#include "../Source/HardwareBackup.h"
+#include "../Source/SyxScanner.h"
+
+// answers requests straight away and remembers what's written
+class FakeMicron : public HardwareBackup::Device {
+public:
+    FakeMicron() : backup(nullptr), writes(0), slots(BackupArchive::NUM_SLOTS * SYSEX_PROGRAM_SIZE) {}
+    void requestProgram(int bank, int program) {
+        backup->programReceived(getSlot(BackupArchive::slotOf(bank, program)), SYSEX_PROGRAM_SIZE);
+    }
+    void writeProgram(int bank, int program, const unsigned char *dump) {
+        memcpy(getSlot(BackupArchive::slotOf(bank, program)), dump, SYSEX_PROGRAM_SIZE);
+        writes++;
+    }
+    unsigned char *getSlot(int slot) { return &slots[(size_t) slot * SYSEX_PROGRAM_SIZE]; }
+
+    HardwareBackup *backup;
+    int writes;
+private:
+    vector<unsigned char> slots;
+};
+
+// answers from a thread of its own, in the order it was asked. the first request for
+// lateSlot is only answered after lateBy ms, what was asked after it waits behind it.
+class LateMicron : public FakeMicron, public Thread {
+public:
+    LateMicron(int slot, int by) : Thread("late micron"), lateSlot(slot), lateBy(by), wasLate(false) { startThread(); }
+    ~LateMicron() { stopThread(1000); }
+    void requestProgram(int bank, int program) {
+        int slot = BackupArchive::slotOf(bank, program);
+        const ScopedLock sl(lock);
+        pending.push_back(slot);
+        late.push_back((slot == lateSlot) && !wasLate);
+        due.push_back(Time::getMillisecondCounter() + (((slot == lateSlot) && !wasLate) ? lateBy : 0));
+        wasLate = wasLate || (slot == lateSlot);
+        notify();
+    }
+    void run() {
+        int spaced = 0;
+        while (!threadShouldExit()) {
+            int slot = -1;
+            bool wasLateOne = false;
+            {
+                const ScopedLock sl(lock);
+                if (!pending.empty() && (Time::getMillisecondCounter() >= due.front())) {
+                    slot = pending.front();
+                    wasLateOne = late.front();
+                    pending.erase(pending.begin());
+                    late.erase(late.begin());
+                    due.erase(due.begin());
+                }
+            }
+            if (slot >= 0) {
+                backup->programReceived(getSlot(slot), SYSEX_PROGRAM_SIZE);
+                // the ones behind it come one by one, as they would over midi
+                spaced = wasLateOne ? 3 : spaced - 1;
+                if (spaced > 0) {
+                    wait(20);
+                }
+            } else {
+                wait(1);
+            }
+        }
+    }
+private:
+    const int lateSlot, lateBy;
+    bool wasLate;
+    CriticalSection lock;
+    vector<int> pending;
+    vector<bool> late;
+    vector<uint32> due;
+};
+
+class HardwareBackupTest : public UnitTest {
+public:
+    HardwareBackupTest() : UnitTest("HardwareBackup") {}
+
+    void runTest()
+    {
+        SyxScanner scanner;
+        FakeMicron micron;
+        HardwareBackup backup(micron, 100, 0);
+        micron.backup = &backup;
+        scanner.scanFiles(goodCorpus(), 2);
+        int n = scanner.numPrograms();
+        if (n == 0) {
+            return;
+        }
+        for (int slot = 0; slot < BackupArchive::NUM_SLOTS; slot++) {
+            int p = slot % n;
+            MemoryMappedFile map(scanner.getFile(scanner.getProgramFile(p)), MemoryMappedFile::readOnly);
+            memcpy(micron.getSlot(slot), (const char *) map.getData() + scanner.getProgramOffset(p), SYSEX_PROGRAM_SIZE);
+        }
+
+        // the answer to a request that timed out comes after the one sent again was sent
+        beginTest("a late answer isn't taken for the next slot");
+        {
+            LateMicron late(7, 150);
+            HardwareBackup lateBackup(late, 100, 0);
+            late.backup = &lateBackup;
+            memcpy(late.getSlot(0), micron.getSlot(0), (size_t) BackupArchive::NUM_SLOTS * SYSEX_PROGRAM_SIZE);
+            BackupArchive read;
+            bool same = lateBackup.readDevice(read);
+            for (int slot = 0; same && (slot < BackupArchive::NUM_SLOTS); slot++) {
+                same = (memcmp(read.getSlot(slot), late.getSlot(slot), SYSEX_PROGRAM_SIZE) == 0);
+            }
+            expect(same, "HardwareBackup takes a late answer for another slot: " + lateBackup.getError());
+        }
+
+        beginTest("backup round trips through an archive");
+        TemporaryFile temp(".mnbak");
+        BackupArchive saved, loaded, current;
+        bool same = backup.readDevice(saved) && saved.write(temp.getFile()) && loaded.read(temp.getFile()) &&
+                    (loaded.numSlots() == BackupArchive::NUM_SLOTS);
+        for (int slot = 0; same && (slot < BackupArchive::NUM_SLOTS); slot++) {
+            same = (loaded.getKey(slot) == saved.getKey(slot)) && (loaded.getName(slot) == saved.getName(slot)) &&
+                   (memcmp(saved.getSlot(slot), micron.getSlot(slot), SYSEX_PROGRAM_SIZE) == 0);
+        }
+        expect(same && (temp.getFile().getSize() < BackupArchive::NUM_SLOTS * SYSEX_PROGRAM_SIZE / 2),
+               "BackupArchive doesn't round trip: " + loaded.getError());
+
+        // rename three slots on the unit, a restore puts back just those
+        beginTest("restore writes only what changed");
+        IonSysexParams params;
+        unsigned char renamed[SYSEX_PROGRAM_SIZE];
+        params.readProgramContent(micron.getSlot(0) + 1, SYSEX_CONTENT_SIZE);
+        params.set_prog_name("restore me");
+        params.writeProgram(renamed, sizeof(renamed));
+        int changed[] = { 5, 300, BackupArchive::NUM_SLOTS - 1 };
+        for (int i = 0; i < numElementsInArray(changed); i++) {
+            memcpy(micron.getSlot(changed[i]), renamed, SYSEX_PROGRAM_SIZE);
+        }
+        same = backup.readDevice(current) && backup.writeDevice(loaded, current) && (micron.writes == numElementsInArray(changed)) &&
+               backup.readDevice(current);
+        for (int slot = 0; same && (slot < BackupArchive::NUM_SLOTS); slot++) {
+            same = (current.getKey(slot) == saved.getKey(slot));
+        }
+        expect(same, "HardwareBackup restores " + String(micron.writes) + " slots instead of " + String(numElementsInArray(changed)));
+    }
+};
+
+static HardwareBackupTest hardwareBackupTest;
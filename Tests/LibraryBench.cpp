@@ -0,0 +1,181 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// ns per patch of finding patches in large libraries, on copies of the programs of the
+// given files and a fixed set of random ones, so that runs on different machines and
+// revisions can be compared.
+//
+// usage: library_bench [-n passes] [.syx file or directory]...
+
+#include "Bench.h"
+#include "../Source/PatchSimilarity.h"
+#include "../Source/PatchQuery.h"
+#include "../Source/LibraryIndex.h"
+
+#define SIMILARITY_PATCHES 100000
+#define SIMILARITY_QUERIES 20
+#define BROWSER_FILES 100
+#define BROWSER_PAGE 64
+
+static void benchSimilarity()
+{
+    IonSysexBank bank;
+    PatchSimilarity index;
+    Array<PatchSimilarity::Match> matches;
+
+    // the programs over and over, each copy with a few values moved so they aren't all equal
+    bank.parse(&programs[0], programs.size(), 1);
+    const IonSysexSchema &schema = IonSysexSchema::get();
+    vector<int16> values(schema.numParams());
+    Random rnd(2);
+    index.reserve(SIMILARITY_PATCHES);
+    int64 t = ticks();
+    for (int i = 0; i < SIMILARITY_PATCHES; i++) {
+        memcpy(&values[0], bank.getValues(i % bank.numPrograms()), values.size() * sizeof(int16));
+        for (int n = 0; n < 8; n++) {
+            int idx = rnd.nextInt(schema.numParams());
+            const IonSysexParamDesc &desc = schema.getDesc(idx);
+            values[idx] = (int16) (desc.min + rnd.nextInt(jmax(1, desc.max - desc.min + 1)));
+        }
+        index.add(&values[0]);
+    }
+    report("PatchSimilarity::add", ticks() - t, SIMILARITY_PATCHES);
+
+    int queries = jmax(1, passes / 10) * SIMILARITY_QUERIES;
+    int acc = 0;
+    t = ticks();
+    for (int q = 0; q < queries; q++) {
+        acc += index.queryPatch((q * 7919) % SIMILARITY_PATCHES, 10, matches);
+    }
+    int64 elapsed = ticks() - t;
+    report("PatchSimilarity::queryPatch, k = 10", elapsed, (int64) queries * SIMILARITY_PATCHES);
+    printf("%-44s %10.3f ms/query over %d patches\n", "", nanos(elapsed) / queries / 1e6, SIMILARITY_PATCHES);
+    sink = acc;
+}
+
+static void benchLibrary()
+{
+    TemporaryFile temp(".mnlib");
+    {
+        PatchLibrary::Builder builder;
+        for (int i = 0; i < SIMILARITY_PATCHES; i++) {
+            builder.add(program(i % numPrograms), SYSEX_PROGRAM_SIZE);
+        }
+        int64 t = ticks();
+        builder.write(temp.getFile());
+        report("PatchLibrary::Builder::write", ticks() - t, SIMILARITY_PATCHES);
+    }
+
+    PatchLibrary library;
+    int64 t = ticks();
+    library.open(temp.getFile());
+    printf("%-44s %10.3f ms for %d patches\n", "PatchLibrary::open", nanos(ticks() - t) / 1e6, library.numPatches());
+
+    // a filter on one parameter only reads its column
+    int column = IonSysexSchema::get().indexOfNrpn(556);
+    int acc = 0;
+    t = ticks();
+    for (int pass = 0; pass < passes; pass++) {
+        const int16 *freq = library.getColumn(column);
+        for (int i = 0; i < library.numPatches(); i++) {
+            acc += (freq[i] > 500);
+        }
+    }
+    report("PatchLibrary column filter", ticks() - t, (int64) passes * library.numPatches());
+
+    PatchQuery query(library);
+    const char *text = "filter 1 type = mg and env 3 attack < 200 and mod env 1 -> flt1frq";
+    int queries = jmax(1, passes / 10) * SIMILARITY_QUERIES;
+    t = ticks();
+    for (int q = 0; q < queries; q++) {
+        query.run(String::empty);
+        query.run(text);
+        acc += query.numMatches();
+    }
+    printf("%-44s %10.3f ms/query over %d patches\n", "PatchQuery::run, three clauses", nanos(ticks() - t) / queries / 1e6, library.numPatches());
+
+    // typing a name, the first trigram search builds the index
+    query.run("name ~ mic");
+    String typed = "filter 1 type != bypass and name ~ micronau";
+    t = ticks();
+    for (int q = 0; q < queries; q++) {
+        query.run(String::empty);
+        for (int c = typed.length() - 8; c <= typed.length(); c++) {
+            query.run(typed.substring(0, c));
+            acc += query.numMatches();
+        }
+    }
+    printf("%-44s %10.3f ms/keystroke\n", "PatchQuery::run, typing a name", nanos(ticks() - t) / queries / 9 / 1e6);
+    sink = acc;
+}
+
+// what a patch browser does with a library index: sorting and filtering it, and
+// fetching the rows in view
+static void benchBrowser()
+{
+    TemporaryFile temp;
+    File dir = temp.getFile();
+    dir.createDirectory();
+    Array<File> files;
+    for (int f = 0; f < BROWSER_FILES; f++) {
+        MemoryBlock data;
+        for (int i = 0; i < SIMILARITY_PATCHES / BROWSER_FILES; i++) {
+            data.append(program((f * SIMILARITY_PATCHES / BROWSER_FILES + i) % numPrograms), SYSEX_PROGRAM_SIZE);
+        }
+        files.add(dir.getChildFile(String(f) + ".syx"));
+        files.getLast().replaceWithData(data.getData(), data.getSize());
+    }
+
+    LibraryIndex index;
+    int64 t = ticks();
+    index.update(files);
+    report("LibraryIndex::update", ticks() - t, index.numPatches());
+
+    vector<int> order;
+    int selects = jmax(1, passes / 20);
+    t = ticks();
+    for (int q = 0; q < selects; q++) {
+        index.select(String::empty, LibraryIndex::BY_NAME, order);
+    }
+    printf("%-44s %10.3f ms over %d patches\n", "LibraryIndex::select, by name", nanos(ticks() - t) / selects / 1e6, index.numPatches());
+    // the first name query builds the trigram index, as in benchLibrary. then the filter
+    // is cleared and typed again each time, so the name clause is run and not remembered.
+    index.select("name ~ mic", LibraryIndex::BY_FILE, order);
+    t = ticks();
+    for (int q = 0; q < selects; q++) {
+        index.select(String::empty, LibraryIndex::BY_FILE, order);
+        index.select("name ~ mic", LibraryIndex::BY_FILE, order);
+    }
+    printf("%-44s %10.3f ms over %d patches\n", "LibraryIndex::select, name filter", nanos(ticks() - t) / selects / 1e6, index.numPatches());
+
+    // a page of rows, as fetched while scrolling
+    index.select(String::empty, LibraryIndex::BY_NAME, order);
+    LibraryIndex::Patch rows[BROWSER_PAGE];
+    bool found[BROWSER_PAGE];
+    int pages = (int) order.size() / BROWSER_PAGE;
+    int acc = 0;
+    t = ticks();
+    for (int p = 0; p < pages; p++) {
+        index.getPatches(&order[p * BROWSER_PAGE], BROWSER_PAGE, rows, found);
+        acc += rows[0].category;
+    }
+    report("LibraryIndex::getPatches", ticks() - t, (int64) pages * BROWSER_PAGE, "row");
+    sink = acc;
+    dir.deleteRecursively();
+}
+
+int main(int argc, char **argv)
+{
+    loadPrograms(argc, argv);
+
+    benchSimilarity();
+    benchLibrary();
+    benchBrowser();
+    return 0;
+}
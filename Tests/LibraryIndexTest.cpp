@@ -0,0 +1,144 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// the patch numbers of a LibraryIndex have to stay with their file and program while
+// files come and go, in this session and the next one, and its programs have to be the
+// ones in the files after the libraries holding them have been merged. select() has to
+// find what the query asks for in all of them.
+
+#include "TestSupport.h"
+#include "../Source/LibraryIndex.h"
+
+#define COPIES 24     // one update each, more than get merged
+
+class LibraryIndexTest : public UnitTest {
+public:
+    LibraryIndexTest() : UnitTest("LibraryIndex") {}
+
+    void runTest()
+    {
+        beginTest("patch numbers stay with the patches");
+        vector<unsigned char> programs;
+        for (int f = 0; f < goodCorpus().size(); f++) {
+            addPrograms(goodCorpus().getReference(f), programs);
+        }
+        int n = (int) (programs.size() / SYSEX_PROGRAM_SIZE);
+        expect(n > 0, "no programs in the corpus");
+
+        // copies of all programs, each one rotated by its number so every file is different
+        TemporaryFile temp;
+        File dir = temp.getFile();
+        dir.createDirectory();
+        Array<File> files;
+        for (int c = 0; c < COPIES; c++) {
+            MemoryBlock data;
+            for (int i = 0; i < n; i++) {
+                data.append(&programs[(size_t) ((i + c) % n) * SYSEX_PROGRAM_SIZE], SYSEX_PROGRAM_SIZE);
+            }
+            files.add(dir.getChildFile(String::formatted("%02d.syx", c)));
+            files.getLast().replaceWithData(data.getData(), data.getSize());
+        }
+
+        // the later files first, one at a time, numbered as they come. then all of them
+        // at once, the new ones numbered in path order after them.
+        LibraryIndex index;
+        for (int c = COPIES / 2; c < COPIES; c++) {
+            index.update(Array<File>(&files.getReference(c), 1));
+        }
+        index.update(files);
+        expect(holds(index, files, n), "the programs aren't the ones in the files");
+
+        // one at a time again, the libraries of the earlier updates get merged
+        for (int c = 0; c < COPIES; c++) {
+            index.update(Array<File>(&files.getReference(c), 1));
+        }
+        expectEquals(index.numPatches(), COPIES * n);
+        expect(holds(index, files, n), "the programs aren't the ones in the files after merging");
+
+        // the queries run over all the libraries, merged or not
+        vector<int> all, some;
+        LibraryIndex::Patch p;
+        expect(index.select(String::empty, LibraryIndex::BY_NAME, all) && ((int) all.size() == index.numPatches()) &&
+               index.getPatch(all[0], p), "an empty query doesn't select every patch");
+        String name = p.name.substring(0, 4).trim();
+        expect(index.select("category = " + String(p.category) + " and name ~ " + name, LibraryIndex::BY_FILE, some),
+               "the query doesn't parse");
+        int expected = 0;
+        for (int i = 0; i < index.numNumbers(); i++) {
+            LibraryIndex::Patch q;
+            expected += (index.getPatch(i, q) && (q.category == p.category) && q.name.containsIgnoreCase(name)) ? 1 : 0;
+        }
+        expect((expected > 0) && ((int) some.size() == expected), "select finds other patches than the query says");
+        expect(!index.select("no such parameter = 3", LibraryIndex::BY_FILE, some) && some.empty(), "a bad query selects something");
+
+        Array<File> gone;
+        gone.add(files[1]);
+        index.remove(gone);
+        expectEquals(index.numPatches(), (COPIES - 1) * n);
+        expectEquals(index.numNumbers(), COPIES * n);
+        expect(!index.getPatch(number(1, 0, n), p), "a removed file still has patches");
+        expect(holds(index, files, n, 1), "removing a file moves the others");
+
+        // new files get new numbers, the old one its own back
+        MemoryBlock extra;
+        extra.append(&programs[0], SYSEX_PROGRAM_SIZE);
+        File added = dir.getChildFile("00a.syx");
+        added.replaceWithData(extra.getData(), extra.getSize());
+        Array<File> back;
+        back.add(added);
+        back.add(files[1]);
+        index.update(back);
+        expectEquals(index.numNumbers(), COPIES * n + 1);
+        expect(holds(index, files, n) && index.getPatch(COPIES * n, p) && (p.file == added), "adding files renumbers the others");
+
+        // the next session gets the same numbers for the files still there
+        String saved = index.saveNumbers(dir);
+        LibraryIndex next;
+        next.restoreNumbers(saved, dir);
+        next.update(files);
+        expect(holds(next, files, n), "restored numbers differ");
+        expectEquals(next.numNumbers(), COPIES * n + 1);
+        expect(!next.getPatch(COPIES * n, p), "a file not there yet has patches");
+
+        next.restoreNumbers("garbage\t-1 5-2 9999999999\n\t\n", dir);
+        next.update(files);
+        expectEquals(next.numPatches(), COPIES * n);
+        dir.deleteRecursively();
+    }
+
+    // the number of program i of copy c, as the updates in runTest() give them out
+    static int number(int c, int i, int n)
+    {
+        int order = (c >= COPIES / 2) ? c - COPIES / 2 : c + (COPIES - COPIES / 2);
+        return order * n + i;
+    }
+
+    // whether every copy but skip has its programs under its numbers
+    bool holds(const LibraryIndex &index, const Array<File> &files, int n, int skip = -1)
+    {
+        unsigned char program[SYSEX_PROGRAM_SIZE];
+        for (int c = 0; c < files.size(); c++) {
+            MemoryBlock data;
+            if ((c == skip) || !files[c].loadFileAsData(data)) {
+                continue;
+            }
+            for (int i = 0; i < n; i++) {
+                LibraryIndex::Patch p;
+                if (!index.getProgram(number(c, i, n), program) || !index.getPatch(number(c, i, n), p) ||
+                    (p.file != files[c]) || (p.offset != (int64) i * SYSEX_PROGRAM_SIZE) ||
+                    (memcmp(program, (const char *) data.getData() + p.offset, SYSEX_PROGRAM_SIZE) != 0)) {
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+};
+
+static LibraryIndexTest libraryIndexTest;
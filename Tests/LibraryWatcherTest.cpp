@@ -0,0 +1,65 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// a LibraryIndex kept by a LibraryWatcher has to follow the files of the corpus, damaged
+// ones too, being copied in and removed.
+
+#include "TestSupport.h"
+#include "../Source/LibraryWatcher.h"
+#include "../Source/SyxScanner.h"
+
+class LibraryWatcherTest : public UnitTest {
+public:
+    LibraryWatcherTest() : UnitTest("LibraryWatcher") {}
+
+    void runTest()
+    {
+        beginTest("the index follows the files");
+        Array<File> files(goodCorpus());
+        files.addArray(damagedCorpus());
+        SyxScanner scanner;
+        scanner.scanFiles(files, 2);
+
+        TemporaryFile temp;
+        File dir = temp.getFile();
+        LibraryIndex index;
+        LibraryWatcher watcher(index, dir);
+        bool same = dir.createDirectory();
+
+        // every file in a directory of its own, half of them copied in before the first sync,
+        // every other one with its extension in capitals
+        int n = scanner.numFiles();
+        for (int i = 0; same && (i < n); i++) {
+            File sub = dir.getChildFile(String(i % 4));
+            same = sub.createDirectory() && scanner.getFile(i).copyFileTo(sub.getChildFile(String(i) + ((i & 1) ? ".SYX" : ".syx")));
+            if (i == n / 2) {
+                watcher.resync();
+            }
+        }
+        watcher.resync();
+        same = same && (index.numFiles() == n) && (index.numPatches() == scanner.numPrograms());
+        LibraryIndex::Patch patch;
+        int64 total = 0;
+        for (int i = 0; same && (i < index.numPatches()); i++) {
+            same = index.getPatch(i, patch);
+            total += (int64) patch.hash;
+        }
+        for (int i = 0; i < scanner.numPrograms(); i++) {
+            total -= (int64) scanner.getHash(i);
+        }
+        expect(same && (total == 0), "LibraryIndex doesn't hold the programs of the files");
+
+        dir.getChildFile("0").deleteRecursively();
+        watcher.resync();
+        expect(index.numFiles() == n - (n + 3) / 4, "LibraryIndex doesn't follow a directory being removed");
+        dir.deleteRecursively();
+    }
+};
+
+static LibraryWatcherTest libraryWatcherTest;
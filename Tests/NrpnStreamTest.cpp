@@ -0,0 +1,63 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// every program of the corpus has to sync the same through a NrpnStream as without,
+// in fewer bytes.
+
+#include "TestSupport.h"
+
+class NrpnStreamTest : public UnitTest {
+public:
+    NrpnStreamTest() : UnitTest("NrpnStream") {}
+
+    void runTest()
+    {
+        beginTest("syncs and sweeps");
+        for (int f = 0; f < goodCorpus().size(); f++) {
+            const File &file = goodCorpus().getReference(f);
+            MemoryBlock data;
+            IonSysexBank bank;
+            IonSysexParams params;
+            expect(loadBank(file, data, bank) && (bank.numPrograms() > 0), file.getFullPathName() + ": no programs");
+            for (int i = 0; i < bank.numMessages(); i++) {
+                const IonSysexBank::Message &m = bank.getMessage(i);
+                if ((m.status == PROGRAM_OK) && params.readProgramContent((const unsigned char *) data.getData() + m.offset + 1, SYSEX_CONTENT_SIZE)) {
+                    checkNrpnStream(file, m.program, params);
+                }
+            }
+        }
+    }
+
+    void checkNrpnStream(const File &file, int idx, IonSysexParams &params)
+    {
+        unsigned char plain[BANK_PROGRAM_MSG_SIZE + 1024 * NRPN_MSG_SIZE];
+        unsigned char packed[sizeof(plain)];
+        NrpnStream stream;
+        int n = encodeProgramNrpns(0, params, plain, sizeof(plain));
+        int m = encodeProgramNrpns(0, params, packed, sizeof(packed), &stream);
+        expect((m < n) && (receive(plain, n) == receive(packed, m)), where(file, idx) + "NrpnStream sends a different sync");
+
+        // a sweep of one nrpn is just the data entry lsb, in running status
+        stream.endBatch();
+        m = stream.encodeNrpn(0, 300, 0, packed);
+        for (int v = 1; v < 100; v++) {
+            m += stream.encodeNrpn(0, 300, v, packed + m);
+        }
+        expect(m <= NRPN_MSG_SIZE + 99 * 2, where(file, idx) + "NrpnStream doesn't compress a sweep");
+
+        // the next batch keeps the nrpn selected but starts with its status byte
+        Receiver r;
+        receive(packed, m, r);
+        stream.endBatch();
+        m = stream.encodeNrpn(0, 300, 200, packed);
+        expect(receive(packed, m, r) == vector<int>(1, (300 << 14) | 200), where(file, idx) + "NrpnStream starts a batch in running status");
+    }
+};
+
+static NrpnStreamTest nrpnStreamTest;
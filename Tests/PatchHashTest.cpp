@@ -0,0 +1,63 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// the canonical hash of every program of the corpus has to stay the same for a copy
+// under another name, and change with any value.
+
+#include "TestSupport.h"
+
+class PatchHashTest : public UnitTest {
+public:
+    PatchHashTest() : UnitTest("canonical hash") {}
+
+    void runTest()
+    {
+        beginTest("renamed copies and changed programs");
+        for (int f = 0; f < goodCorpus().size(); f++) {
+            const File &file = goodCorpus().getReference(f);
+            MemoryBlock data;
+            IonSysexBank bank;
+            expect(loadBank(file, data, bank) && (bank.numPrograms() > 0), file.getFullPathName() + ": no programs");
+            for (int i = 0; i < bank.numMessages(); i++) {
+                const IonSysexBank::Message &m = bank.getMessage(i);
+                if (m.status == PROGRAM_OK) {
+                    checkProgram(file, m.program, (const unsigned char *) data.getData() + m.offset, bank.getHash(m.program));
+                }
+            }
+        }
+    }
+
+    void checkProgram(const File &file, int idx, const unsigned char *program, uint64 bankHash)
+    {
+        IonSysexParams params;
+        unsigned char out[SYSEX_PROGRAM_SIZE];
+        if (!params.readProgramContent(program + 1, SYSEX_CONTENT_SIZE)) {
+            expect(false, where(file, idx) + "can't read program");
+            return;
+        }
+        // a dump that doesn't encode back the same can't be expected to decode to the same values
+        params.writeProgram(out, sizeof(out));
+        bool exact = (memcmp(out, program, SYSEX_PROGRAM_SIZE) == 0);
+
+        // a copy under another name is the same sound, another value isn't
+        const IonSysexSchema &schema = IonSysexSchema::get();
+        vector<int16> values(schema.numParams());
+        char name[15];
+        params.set_prog_name(params.get_prog_name() + " copy");
+        params.writeProgram(out, sizeof(out));
+        expect((params.canonicalHash() == bankHash) && (!exact || ((schema.decodeProgram(out, sizeof(out), &values[0], name) == PROGRAM_OK) &&
+               (schema.canonicalHash(&values[0]) == bankHash))), where(file, idx) + "renamed copy hashes differently");
+
+        IonSysexParam *env = params.getParamByNrpn(578);
+        env->setValue((env->getValue() == env->getMin()) ? env->getMax() : env->getMin());
+        expect(params.canonicalHash() != bankHash, where(file, idx) + "changed program hashes the same");
+    }
+};
+
+static PatchHashTest patchHashTest;
@@ -0,0 +1,75 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// a PatchLibrary written from a scan of the corpus has to give every program back as
+// scanned, and PatchQuery has to find them. headers that are damaged mustn't open.
+
+#include "TestSupport.h"
+#include "../Source/PatchQuery.h"
+#include "../Source/SyxScanner.h"
+
+class PatchLibraryTest : public UnitTest {
+public:
+    PatchLibraryTest() : UnitTest("PatchLibrary") {}
+
+    void runTest()
+    {
+        SyxScanner scanner;
+        TemporaryFile temp(".mnlib");
+        PatchLibrary::Builder builder;
+        PatchLibrary library;
+
+        beginTest("programs come back as scanned");
+        scanner.scanFiles(goodCorpus(), 2);
+        builder.addScan(scanner);
+        if (!builder.write(temp.getFile()) || !library.open(temp.getFile())) {
+            expect(false, "can't write and open a PatchLibrary: " + library.getError());
+            return;
+        }
+        bool same = (library.numPatches() == scanner.numPrograms());
+        vector<int16> values(library.numParams());
+        for (int i = 0; same && (i < library.numPatches()); i++) {
+            MemoryMappedFile map(scanner.getFile(scanner.getProgramFile(i)), MemoryMappedFile::readOnly);
+            library.getValues(i, &values[0]);
+            same = (library.getHash(i) == scanner.getHash(i)) && (library.getName(i) == scanner.getName(i)) &&
+                   (memcmp(&values[0], scanner.getValues(i), values.size() * sizeof(int16)) == 0) &&
+                   (memcmp(library.getProgram(i), (const char *) map.getData() + scanner.getProgramOffset(i), SYSEX_PROGRAM_SIZE) == 0);
+        }
+        expect(same, "PatchLibrary gives back different programs");
+
+        beginTest("PatchQuery finds every patch by category and name");
+        PatchQuery query(library);
+        int category = IonSysexSchema::get().indexOfNrpn(666);
+        for (int i = 0; i < library.numPatches(); i++) {
+            String name = library.getName(i).substring(0, 4).trim();
+            String text = "category = " + String(library.getValue(i, category)) + " and name ~ " + name;
+            expect(query.run(text) && query.matches(i), "PatchQuery doesn't find patch " + String(i) + " with " + text);
+        }
+
+        // offsets and sizes that only fit by wrapping around don't open
+        beginTest("damaged headers");
+        MemoryBlock data;
+        temp.getFile().loadFileAsData(data);
+        for (int k = 0; k < 2; k++) {
+            TemporaryFile damaged(".mnlib");
+            MemoryBlock bad(data);
+            PatchLibraryHeader *h = (PatchLibraryHeader *) bad.getData();
+            if (k == 0) {
+                h->namesOffset = ~(uint64) 0 - 8;
+            } else {
+                h->columnStride = ((~(uint64) 0 / h->numParams) + 8) & ~(uint64) 7;
+            }
+            PatchLibrary other;
+            expect(damaged.getFile().replaceWithData(bad.getData(), bad.getSize()) && !other.open(damaged.getFile()),
+                   "PatchLibrary opens a damaged header");
+        }
+    }
+};
+
+static PatchLibraryTest patchLibraryTest;
@@ -0,0 +1,39 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// every program of the corpus has to be its own closest match in a PatchSimilarity
+// index of its file.
+
+#include "TestSupport.h"
+#include "../Source/PatchSimilarity.h"
+
+class PatchSimilarityTest : public UnitTest {
+public:
+    PatchSimilarityTest() : UnitTest("PatchSimilarity") {}
+
+    void runTest()
+    {
+        beginTest("every program is its own closest match");
+        for (int f = 0; f < goodCorpus().size(); f++) {
+            const File &file = goodCorpus().getReference(f);
+            MemoryBlock data;
+            IonSysexBank bank;
+            expect(loadBank(file, data, bank) && (bank.numPrograms() > 0), file.getFullPathName() + ": no programs");
+            PatchSimilarity index;
+            Array<PatchSimilarity::Match> matches;
+            index.addBank(bank);
+            for (int i = 0; i < bank.numPrograms(); i++) {
+                expect((index.query(bank.getValues(i), 1, matches) == 1) && (matches[0].distance == 0),
+                       where(file, i) + "isn't its own closest match");
+            }
+        }
+    }
+};
+
+static PatchSimilarityTest patchSimilarityTest;
@@ -0,0 +1,48 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// SyxScanner has to come up with the same programs and errors as IonSysexBank, in file
+// order, whatever the number of threads.
+
+#include "TestSupport.h"
+#include "../Source/SyxScanner.h"
+
+class SyxScannerTest : public UnitTest {
+public:
+    SyxScannerTest() : UnitTest("SyxScanner") {}
+
+    void runTest()
+    {
+        beginTest("same programs as IonSysexBank");
+        Array<File> files(goodCorpus());
+        files.addArray(damagedCorpus());
+        vector<uint64> hashes;
+        int errors = 0;
+        for (int i = 0; i < files.size(); i++) {
+            MemoryBlock data;
+            IonSysexBank bank;
+            loadBank(files[i], data, bank);
+            for (int p = 0; p < bank.numPrograms(); p++) {
+                hashes.push_back(bank.getHash(p));
+            }
+            errors += bank.numErrors();
+        }
+        for (int threads = 1; threads <= 4; threads *= 2) {
+            SyxScanner scanner;
+            scanner.scanFiles(files, threads);
+            bool same = (scanner.numPrograms() == (int) hashes.size()) && (scanner.numErrors() == errors);
+            for (int i = 0; same && (i < scanner.numPrograms()); i++) {
+                same = (scanner.getHash(i) == hashes[i]);
+            }
+            expect(same, "SyxScanner finds different programs with " + String(threads) + " threads");
+        }
+    }
+};
+
+static SyxScannerTest syxScannerTest;
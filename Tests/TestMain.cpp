@@ -0,0 +1,40 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// runs every UnitTest of the Tests directory on the programs of the .syx files given.
+// files after -d are damaged ones, with good program dumps among broken messages.
+//
+// usage: micronau_tests [-d <.syx file or directory>]... <.syx file or directory>...
+
+#include "TestSupport.h"
+
+int main(int argc, char **argv)
+{
+    for (int a = 1; a < argc; a++) {
+        if ((strcmp(argv[a], "-d") == 0) && (a + 1 < argc)) {
+            addCorpusFiles(argv[++a], damagedCorpus());
+        } else {
+            addCorpusFiles(argv[a], goodCorpus());
+        }
+    }
+    if (goodCorpus().size() == 0) {
+        printf("usage: micronau_tests [-d <.syx file or directory>]... <.syx file or directory>...\n");
+        return 1;
+    }
+
+    UnitTestRunner runner;
+    runner.runAllTests();
+    int failures = 0;
+    for (int i = 0; i < runner.getNumResults(); i++) {
+        failures += runner.getResult(i)->failures;
+    }
+    printf("%d tests on %d files and %d damaged ones, %d failures\n", runner.getNumResults(),
+           goodCorpus().size(), damagedCorpus().size(), failures);
+    return failures ? 1 : 0;
+}
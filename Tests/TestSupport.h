@@ -0,0 +1,143 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// shared by the tests and benchmarks: the .syx files named on the command line, the
+// good program dumps in them, and what a device makes of the midi we send it.
+
+#ifndef _TESTSUPPORT_H_
+#define _TESTSUPPORT_H_
+
+#include "../Source/SyxScanner.h"
+#include "../Source/NrpnEncoder.h"
+
+// the file named by a command line argument, or the .syx files directly in a directory
+inline void addCorpusFiles(const char *arg, Array<File> &files)
+{
+    File f = File::getCurrentWorkingDirectory().getChildFile(arg);
+    if (f.isDirectory()) {
+        SyxScanner::findSyxFiles(f, false, files);
+    } else {
+        files.add(f);
+    }
+}
+
+// the files the tests run on, from the runner's command line. the good ones hold nothing
+// but program dumps that round trip, the damaged ones good dumps among cut off, odd sized
+// and badly checksummed ones.
+inline Array<File> &goodCorpus()
+{
+    static Array<File> files;
+    return files;
+}
+
+inline Array<File> &damagedCorpus()
+{
+    static Array<File> files;
+    return files;
+}
+
+inline String where(const File &file, int program)
+{
+    return file.getFullPathName() + ", program " + String(program) + ": ";
+}
+
+// a file and what IonSysexBank makes of it, false if it can't be read
+inline bool loadBank(const File &file, MemoryBlock &data, IonSysexBank &bank)
+{
+    if (!file.loadFileAsData(data)) {
+        return false;
+    }
+    bank.parse(data.getData(), data.getSize());
+    return true;
+}
+
+// appends the good program dumps of a file to programs, SYSEX_PROGRAM_SIZE bytes each.
+// returns how many there were.
+inline int addPrograms(const File &file, vector<unsigned char> &programs)
+{
+    MemoryBlock data;
+    IonSysexBank bank;
+    int n = 0;
+    if (!file.loadFileAsData(data)) {
+        return 0;
+    }
+    bank.parse(data.getData(), data.getSize(), 1);
+    for (int i = 0; i < bank.numMessages(); i++) {
+        const IonSysexBank::Message &m = bank.getMessage(i);
+        if (m.status == PROGRAM_OK) {
+            const unsigned char *p = (const unsigned char *) data.getData() + m.offset;
+            programs.insert(programs.end(), p, p + SYSEX_PROGRAM_SIZE);
+            n++;
+        }
+    }
+    return n;
+}
+
+// appends count programs of random values, the same ones every run
+inline void addRandomPrograms(int count, vector<unsigned char> &programs)
+{
+    IonSysexParams params;
+    Random rnd(1);
+    unsigned char out[SYSEX_PROGRAM_SIZE];
+    for (int n = 0; n < count; n++) {
+        for (unsigned int i = 0; i < params.numParams(); i++) {
+            IonSysexParam *p = params.getParam(i);
+            if ((p->getConversionType() != IonSysexParam::NAME) && (p->getConversionType() != IonSysexParam::TEXT_LABEL)) {
+                p->setValue(p->getMin() + rnd.nextInt(p->getMax() - p->getMin() + 1));
+            }
+        }
+        params.set_prog_name(String("random ") + String(n));
+        params.writeProgram(out, sizeof(out));
+        programs.insert(programs.end(), out, out + SYSEX_PROGRAM_SIZE);
+    }
+}
+
+// what a device makes of a midi stream: every data entry lsb sets the selected nrpn
+// to the value, every bank and program change is taken as it comes. every buffer is a
+// batch of its own that starts without running status, like the midi outputs take them:
+// its data bytes before the first status byte get dropped.
+struct Receiver {
+    Receiver() : status(0), msb(0), lsb(0), data(0) {}
+    int status, msb, lsb, data;
+};
+
+inline vector<int> receive(const unsigned char *buf, int size, Receiver &r)
+{
+    vector<int> events;
+    r.status = 0;
+    for (int i = 0; i < size; ) {
+        if (buf[i] & 0x80) {
+            r.status = buf[i++];
+        }
+        else if (r.status == 0) {
+            i++;
+            continue;
+        }
+        if ((r.status & 0xf0) == 0xc0) {
+            events.push_back(-1 - buf[i++]);
+            continue;
+        }
+        int cc = buf[i], value = buf[i + 1];
+        i += 2;
+        if (cc == 0x63) r.msb = value;
+        else if (cc == 0x62) r.lsb = value;
+        else if (cc == 0x06) r.data = value;
+        else if (cc == 0x26) events.push_back(((r.msb << 7 | r.lsb) << 14) | (r.data << 7) | value);
+        else events.push_back(-1000 - (cc << 7 | value));
+    }
+    return events;
+}
+
+inline vector<int> receive(const unsigned char *buf, int size)
+{
+    Receiver r;
+    return receive(buf, size, r);
+}
+
+#endif
@@ -0,0 +1,51 @@
+/*
+ This file is part of micronau.
+ Copyright (c) 2013 - David Smitley
+
+ Permission is granted to use this software under the terms of the GPL v2 (or any later version)
+
+ Details can be found at: www.gnu.org/licenses
+*/
+
+// a TransmitQueue has to send a sweep's latest value and skip what's stale by then.
+
+#include "TestSupport.h"
+#include "../Source/TransmitQueue.h"
+
+// a din link that takes its time, remembering the last value of every slot
+class SlowLink : public TransmitQueue::Target {
+public:
+    SlowLink() : last(4, -1) {}
+    int transmit(int slot, int value) {
+        last[slot] = value;
+        return NRPN_MSG_SIZE;
+    }
+    vector<int> last;
+};
+
+class TransmitQueueTest : public UnitTest {
+public:
+    TransmitQueueTest() : UnitTest("TransmitQueue") {}
+
+    void runTest()
+    {
+        beginTest("a fast sweep");
+        SlowLink link;
+        TransmitQueue queue(link, (int) link.last.size());
+
+        // a host sweeping two parameters a good deal faster than the link can take them
+        for (int v = 0; v < 2000; v++) {
+            queue.post(1, v);
+            queue.post(3, v / 2);
+            if ((v % 100) == 0) {
+                Thread::sleep(1);
+            }
+        }
+        expect(queue.waitUntilSent(5000) && (link.last[1] == 1999) && (link.last[3] == 999) && (link.last[0] == -1) &&
+               (queue.numSent() * 4 <= queue.numPosted()),
+               "TransmitQueue sent " + String((int) queue.numSent()) + " of " + String((int) queue.numPosted()) +
+               " values, the last ones " + String(link.last[1]) + " and " + String(link.last[3]));
+    }
+};
+
+static TransmitQueueTest transmitQueueTest;